@@ -0,0 +1,419 @@
+#!/usr/bin/env python3
+"""
+Generate the batch-major pyJac Jacobian kernels behind eval_jacob_batch.
+
+Each generated jacobs/jacob_<i>.c evaluates its part of the Jacobian of one
+state per call.  For every sub-kernel eval_jacob_<i> this writes
+jacobs/jacob_<i>_batch.c with eval_jacob_<i>_batch, which evaluates the
+same expressions for n <= JACOB_BATCH states in a "#pragma omp simd" loop
+over the batch.  Its scalar arguments become arrays of one value per state
+and entry j of an array argument of state k is read from
+a[j*JACOB_BATCH + k], so that the loads and stores of the loop are
+contiguous over the batch and the loop vectorises.  The rate table lookups
+(PYJAC_RATE_TABLE) are replaced by the expressions they tabulate, which
+vectorise with the vec_math.h exp and log (PYJAC_VEC_MATH).
+
+From eval_jacob in jacob.c it writes jacob_block.c with eval_jacob_block,
+which runs the code of eval_jacob before the sub-kernels for each state of
+the block, gathers the sub-kernel arguments into batch-major buffers, calls
+the batch sub-kernels and scatters the Jacobians back.  See jacob_batch.h.
+
+Run on the generated pyJac sources, compile the resulting
+jacobs/jacob_*_batch.c and jacob_block.c into the pyJac library and set
+PYJAC_BATCH in Make/options:
+
+    python3 batchJacob.py <pyJac output directory>
+
+With checkJacobianBatch in chemistryProperties the chemistry model reports
+the largest relative difference of these and the eval_jacob Jacobians.
+"""
+
+import glob
+import os
+import re
+import sys
+
+from fuseDydtJacob import function
+
+BATCH = 'JACOB_BATCH'
+K = 'k_b'
+
+KERNEL = re.compile(r'^void (eval_jacob_(\d+)) ?\(([^)]*)\)\s*\{\n', re.M)
+
+CALL = re.compile(r'^[ \t]*(eval_jacob_\d+) ?\(([^;]*)\);[ \t]*\n', re.M)
+
+IDENT = re.compile(r'[A-Za-z_]\w*')
+
+
+def parameters(text):
+    """Return the (name, pointer, const) of the parameters in text"""
+    params = []
+
+    for p in text.split(','):
+        name = re.findall(r'(\w+)\s*$', p)[0]
+        params.append((name, '*' in p, p.split()[0] == 'const'))
+
+    return params
+
+
+def stripRateTable(body):
+    """Keep the expressions of the PYJAC_RATE_TABLE blocks"""
+    out = []
+    keep = [True]
+
+    for line in body.splitlines(True):
+        word = line.strip()
+
+        if word == '#ifdef PYJAC_RATE_TABLE':
+            keep.append(False)
+        elif len(keep) > 1 and word == '#else':
+            keep[-1] = True
+        elif len(keep) > 1 and word == '#endif':
+            keep.pop()
+        elif keep[-1]:
+            out.append(line)
+
+    return ''.join(out)
+
+
+def indexPointer(code, name, path):
+    """Index name[j] as name[j*JACOB_BATCH + k]"""
+    out = []
+    i = 0
+
+    for match in re.finditer(r'\b' + name + r'\[', code):
+        if match.start() < i:
+            continue
+
+        depth = 1
+        j = match.end()
+
+        while depth:
+            if j == len(code):
+                sys.exit(path + ': unterminated index of ' + name)
+            depth += {'[': 1, ']': -1}.get(code[j], 0)
+            j += 1
+
+        index = code[match.end():j - 1].strip()
+
+        if not re.fullmatch(r'\d+', index):
+            index = '(' + index + ')'
+
+        out.append(code[i:match.start()])
+        out.append('{0}[{1} * {2} + {3}]'.format(name, index, BATCH, K))
+        i = j
+
+    out.append(code[i:])
+
+    return ''.join(out)
+
+
+def batchKernel(src, path):
+    """Return the name, parameters and batch source of a sub-kernel"""
+    match = KERNEL.search(src)
+
+    if not match:
+        sys.exit(path + ': no sub-kernel eval_jacob_<i> found')
+
+    name = match.group(1)
+    params = parameters(match.group(3))
+    pointers = [p[0] for p in params if p[1]]
+    scalars = [p[0] for p in params if not p[1]]
+
+    _, body = function(src, name, path)
+    body = stripRateTable(body)
+
+    lines = []
+
+    for line in body.rstrip().splitlines():
+        code, sep, comment = line.partition('//')
+
+        for p in pointers:
+            # Stores through a pointer to a single value
+            code = re.sub(
+                r'(^\s*|[=(,]\s*)\*\s*' + p + r'\b', r'\g<1>' + p + '[0]',
+                code
+            )
+            code = indexPointer(code, p, path)
+
+        for s in scalars:
+            code = re.sub(r'\b' + s + r'\b(?!\s*\[)', s + '[' + K + ']', code)
+
+        for p in pointers:
+            if re.search(r'\b' + p + r'\b(?!\[)', code):
+                sys.exit(path + ': ' + p + ' is not only indexed')
+
+        lines.append('  ' + code + sep + comment if line.strip() else '')
+
+    args = []
+
+    for p, pointer, const in params:
+        args.append(
+            ('const ' if const or not pointer else '')
+          + 'double * __restrict__ ' + p
+        )
+
+    src = (
+        '/** Generated by batchJacob.py from ' + name + ' */\n'
+        'void {0}_batch (const int n, {1}) {{\n'
+        '  #pragma omp simd\n'
+        '  for (int {2} = 0; {2} < n; ++{2}) {{\n'
+        '{3}\n'
+        '  }}\n'
+        '}} // end {0}_batch\n'
+    ).format(name, ', '.join(args), K, '\n'.join(lines))
+
+    return name, params, src
+
+
+def declaration(name, params):
+    return 'void {0}_batch (const int, {1});\n'.format(
+        name,
+        ', '.join(
+            ('const ' if const or not pointer else '')
+          + 'double * __restrict__'
+            for _, pointer, const in params
+        )
+    )
+
+
+def arraySize(body, name, path):
+    """Return the size of the local array name declared in body"""
+    match = re.search(
+        r'\bdouble\b[^;]*?\b' + name + r'\s*\[([^\]]+)\]', body
+    )
+
+    if not match:
+        sys.exit(path + ': size of ' + name + ' not found')
+
+    return match.group(1).strip()
+
+
+def block(src, kernels, path):
+    """Return the source of eval_jacob_block"""
+    params, body = function(src, 'eval_jacob', path)
+    t, pres, y, jac = params
+
+    calls = list(CALL.finditer(body))
+
+    if not calls:
+        sys.exit(path + ': no sub-kernel calls found')
+
+    # The code of eval_jacob, without the sub-kernel calls, is run for each
+    # state before the batch sub-kernels.  Code after the first call must
+    # then not use the arguments of the calls before it.
+    perCell = body[:calls[0].start()]
+    used = set()
+
+    for i, call in enumerate(calls):
+        if call.group(1) not in kernels:
+            sys.exit(path + ': ' + call.group(1) + ' not found')
+
+        args = [a.strip() for a in call.group(2).split(',')]
+
+        if len(args) != len(kernels[call.group(1)]):
+            sys.exit(path + ': arguments of ' + call.group(1) + ' differ')
+
+        used.update(IDENT.findall(call.group(2)))
+
+        end = calls[i + 1].start() if i + 1 < len(calls) else len(body)
+        code = body[call.end():end]
+        code = re.sub(r'//[^\n]*', '', code)
+
+        if used & set(IDENT.findall(code)):
+            sys.exit(
+                path + ': code after ' + call.group(1)
+              + ' uses its arguments'
+            )
+
+        perCell += code
+
+    # One batch-major buffer for each distinct argument
+    buffers = {}
+    order = []
+    scatter = []
+
+    for call in calls:
+        for arg, (param, pointer, const) in zip(
+            [a.strip() for a in call.group(2).split(',')],
+            kernels[call.group(1)]
+        ):
+            if arg in buffers:
+                continue
+
+            if not pointer:
+                size = '1'
+                var = arg if IDENT.fullmatch(arg) else param
+                value = arg if IDENT.fullmatch(arg) else '(' + arg + ')'
+                indexed = None
+            elif arg.startswith('&') and IDENT.fullmatch(arg[1:].strip()):
+                size = '1'
+                var = arg[1:].strip()
+                value = var
+                indexed = None
+            elif IDENT.fullmatch(arg):
+                var = arg
+                if arg == jac:
+                    size = 'JAC_SIZE'
+                    scatter.append(arg)
+                elif arg == y:
+                    size = 'NN'
+                else:
+                    size = arraySize(perCell, arg, path)
+                value = None
+                indexed = arg
+            else:
+                sys.exit(path + ': unsupported argument ' + arg)
+
+            buffers[arg] = (var + '_b', size, value, indexed)
+            order.append(arg)
+
+    out = []
+    out.append(
+        '/** Generated by batchJacob.py from eval_jacob */\n'
+        'void eval_jacob_block (const int n, const double {0}, '
+        'const double * __restrict__ {1}_in, '
+        'const double * __restrict__ {2}_in, const int {2}_stride, '
+        'double * __restrict__ {3}_in, const int {3}_stride) {{\n\n'
+        .format(t, pres, y, jac)
+    )
+
+    for arg in order:
+        buf, size, _, _ = buffers[arg]
+        if size == '1':
+            out.append('  double {0}[{1}];\n'.format(buf, BATCH))
+        else:
+            out.append(
+                '  double {0}[({1}) * {2}];\n'.format(buf, size, BATCH)
+            )
+
+    out.append(
+        '\n  // the code of eval_jacob before its sub-kernels for each state\n'
+        '  for (int {0} = 0; {0} < n; ++{0}) {{\n'
+        '    const double {1} = {1}_in[{0}];\n'
+        '    const double * __restrict__ {2} = '
+        '&{2}_in[(size_t){0} * {2}_stride];\n'
+        '    double * __restrict__ {3} = '
+        '&{3}_in[(size_t){0} * {3}_stride];\n'
+        .format(K, pres, y, jac)
+    )
+    out.append(
+        '\n'.join(
+            '  ' + line if line.strip() else ''
+            for line in perCell.strip('\n').splitlines()
+        ) + '\n\n'
+    )
+    out.append('    // gather the sub-kernel arguments\n')
+
+    for arg in order:
+        buf, size, value, indexed = buffers[arg]
+        if indexed is None:
+            out.append('    {0}[{1}] = {2};\n'.format(buf, K, value))
+        else:
+            out.append(
+                '    for (int i = 0; i < {0}; ++i) {{\n'
+                '      {1}[i * {2} + {3}] = {4}[i];\n'
+                '    }}\n'.format(size, buf, BATCH, K, indexed)
+            )
+
+    out.append('  }\n\n')
+
+    for call in calls:
+        out.append(
+            '  {0}_batch (n, {1});\n'.format(
+                call.group(1),
+                ', '.join(
+                    buffers[a.strip()][0]
+                    for a in call.group(2).split(',')
+                )
+            )
+        )
+
+    out.append('\n  // scatter the Jacobians\n')
+
+    for arg in scatter:
+        buf, size, _, _ = buffers[arg]
+        out.append(
+            '  for (int {0} = 0; {0} < n; ++{0}) {{\n'
+            '    for (int i = 0; i < {1}; ++i) {{\n'
+            '      {2}_in[(size_t){0} * {2}_stride + i] = '
+            '{3}[i * {4} + {0}];\n'
+            '    }}\n'
+            '  }}\n'.format(K, size, arg, buf, BATCH)
+        )
+
+    out.append('\n} // end eval_jacob_block\n\n')
+
+    return ''.join(out)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('Usage: batchJacob.py <pyJac output directory>')
+
+    root = sys.argv[1]
+    paths = sorted(
+        p for p in glob.glob(os.path.join(root, 'jacobs', 'jacob_*.c'))
+        if re.fullmatch(r'jacob_\d+\.c', os.path.basename(p))
+    )
+
+    if not paths:
+        sys.exit(os.path.join(root, 'jacobs') + ': no sub-kernels found')
+
+    kernels = {}
+    declarations = []
+
+    for path in paths:
+        with open(path) as f:
+            name, params, src = batchKernel(f.read(), path)
+
+        kernels[name] = params
+        declarations.append(declaration(name, params))
+
+        out = path[:-2] + '_batch.c'
+
+        with open(out, 'w') as f:
+            f.write(
+                '#include <math.h>\n'
+                '#include "header.h"\n'
+                '#include "jac_batch_include.h"\n\n'
+            )
+            f.write(src + '\n')
+
+        print('Written ' + out)
+
+    out = os.path.join(root, 'jacobs', 'jac_batch_include.h')
+
+    with open(out, 'w') as f:
+        f.write(
+            '#ifndef JAC_BATCH_INCLUDE_H\n'
+            '#define JAC_BATCH_INCLUDE_H\n\n'
+            '#include "header.h"\n'
+            '#include "jacob_batch.h"\n\n'
+        )
+        f.write(''.join(declarations))
+        f.write('\n#endif\n')
+
+    print('Written ' + out)
+
+    path = os.path.join(root, 'jacob.c')
+
+    with open(path) as f:
+        src = f.read()
+
+    includes = [
+        line for line in src.splitlines() if line.startswith('#include')
+    ]
+    includes.append('#include "jacobs/jac_batch_include.h"')
+
+    out = os.path.join(root, 'jacob_block.c')
+
+    with open(out, 'w') as f:
+        f.write('\n'.join(includes) + '\n\n')
+        f.write(block(src, kernels, path))
+
+    print('Written ' + out)
+
+
+if __name__ == '__main__':
+    main()
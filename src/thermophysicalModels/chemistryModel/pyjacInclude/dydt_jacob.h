@@ -0,0 +1,19 @@
+#ifndef DYDT_JACOB_HEAD
+#define DYDT_JACOB_HEAD
+
+#include "header.h"
+#include "thermo_table.h"
+
+/**
+ * Evaluate the rates of change dy (as dydt) and the Jacobian jac (as
+ * eval_jacob) of the state y at the pressure pres from one evaluation of
+ * the reaction rates.  With -DPYJAC_THERMO_TABLE the species enthalpies
+ * and heat capacities are read from the table (see thermo_table.h).
+ *
+ * The source dydt_jacob.c is generated from the pyJac jacob.c and dydt.c by
+ * fuseDydtJacob.py and compiled into the pyJac library, which is then
+ * flagged by compiling with -DPYJAC_DYDT_JACOB.
+ */
+void eval_dydt_jacob (const double, const double, const double * __restrict__, double * __restrict__, double * __restrict__, const thermo_table *);
+
+#endif
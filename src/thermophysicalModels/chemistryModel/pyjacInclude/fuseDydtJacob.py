@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""
+Generate the fused pyJac right-hand side and Jacobian, eval_dydt_jacob.
+
+dydt and eval_jacob each evaluate the concentrations, the forward and
+reverse rates, the pressure modification and the species rates from
+scratch.  eval_dydt_jacob is the body of eval_jacob followed by the part of
+dydt after its species rates, which reads them from the rates already
+evaluated for the Jacobian, so that the rates are evaluated once.  See
+dydt_jacob.h.
+
+Run on the generated pyJac sources (jacob.c and dydt.c) and compile the
+resulting dydt_jacob.c into the pyJac library:
+
+    python3 fuseDydtJacob.py <pyJac output directory>
+
+Compiled with -DPYJAC_THERMO_TABLE the species enthalpies and heat
+capacities of both are interpolated from the thermo table passed as the
+last argument, see thermo_table.h.
+"""
+
+import os
+import re
+import sys
+
+SPEC_RATES = re.compile(
+    r'^\s*eval_spec_rates \(fwd_rates, rev_rates, pres_mod, spec_rates, '
+    r'&spec_rates\[NSP - 1\]\);\n',
+    re.M
+)
+
+DYDT_SPEC_RATES = re.compile(
+    r'^\s*eval_spec_rates \(fwd_rates, rev_rates, pres_mod, '
+    r'&(\w+)\[1\], &(\w+)\);\n',
+    re.M
+)
+
+
+def function(src, name, path):
+    """Return the parameter names and the body of function name"""
+    match = re.search(
+        r'^void ' + name + r' ?\(([^)]*)\)\s*\{\n', src, re.M
+    )
+
+    if not match:
+        sys.exit(path + ': function ' + name + ' not found')
+
+    params = [re.findall(r'(\w+)\s*$', p)[0]
+              for p in match.group(1).split(',')]
+
+    depth = 1
+    i = match.end()
+
+    while depth:
+        if i == len(src):
+            sys.exit(path + ': unterminated function ' + name)
+        depth += {'{': 1, '}': -1}.get(src[i], 0)
+        i += 1
+
+    return params, src[match.end():i - 1]
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('Usage: fuseDydtJacob.py <pyJac output directory>')
+
+    paths = [os.path.join(sys.argv[1], f) for f in ('jacob.c', 'dydt.c')]
+    srcs = []
+
+    for path in paths:
+        with open(path) as f:
+            srcs.append(f.read())
+
+    jParams, jBody = function(srcs[0], 'eval_jacob', paths[0])
+    dParams, dBody = function(srcs[1], 'dydt', paths[1])
+
+    if jParams[:3] != dParams[:3]:
+        sys.exit('Arguments of eval_jacob and dydt differ')
+
+    if not SPEC_RATES.search(jBody):
+        sys.exit(paths[0] + ': species rates not found')
+
+    for var in ('y_N', 'mw_avg', 'rho'):
+        if not re.search(r'\bdouble ' + var + r'\b', jBody):
+            sys.exit(paths[0] + ': ' + var + ' not found')
+
+    match = DYDT_SPEC_RATES.search(dBody)
+
+    if not match or match.group(1) != dParams[3]:
+        sys.exit(paths[1] + ': species rates not found')
+
+    # The rest of dydt, in a block of its own so that its thermo arrays
+    # do not clash with those of eval_jacob
+    tail = dBody[match.end():].rstrip()
+
+    dy = dParams[3]
+    dyN = match.group(2)
+
+    includes = []
+
+    for src in srcs:
+        for line in src.splitlines():
+            if line.startswith('#include') and line not in includes:
+                includes.append(line)
+
+    includes.append('#include "dydt_jacob.h"')
+
+    thermoTable = (
+        '#ifdef PYJAC_THERMO_TABLE\n'
+        '#define eval_h(T, h) thermo_table_h(table, T, h)\n'
+        '#define eval_cp(T, cp) thermo_table_cp(table, T, cp)\n'
+        '#endif\n\n'
+    )
+
+    with open(os.path.join(sys.argv[1], 'dydt_jacob.c'), 'w') as f:
+        f.write('\n'.join(includes) + '\n\n')
+        f.write(thermoTable)
+        f.write(
+            '/** Generated by fuseDydtJacob.py from eval_jacob and dydt */\n'
+            'void eval_dydt_jacob (const double {0}, const double {1}, '
+            'const double * __restrict__ {2}, double * __restrict__ {3}, '
+            'double * __restrict__ {4}, const thermo_table * table) {{\n\n'
+            '  (void) table;\n'
+            .format(jParams[0], jParams[1], jParams[2], dy, jParams[3])
+        )
+        f.write(jBody.rstrip() + '\n\n')
+        f.write(
+            '  // rates of change from the species rates of the Jacobian\n'
+            '  {{\n'
+            '  double {1} = spec_rates[NSP - 1];\n'
+            '  for (int i = 0; i < NSP - 1; ++i) {{\n'
+            '    {0}[i + 1] = spec_rates[i];\n'
+            '  }}\n'
+            .format(dy, dyN)
+        )
+        f.write(tail + '\n  }\n\n} // end eval_dydt_jacob\n\n')
+
+    print('Written ' + os.path.join(sys.argv[1], 'dydt_jacob.c'))
+
+
+if __name__ == '__main__':
+    main()
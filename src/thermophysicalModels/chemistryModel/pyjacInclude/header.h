@@ -15,4 +15,12 @@
  #define omp_get_max_threads() 1
  #define omp_get_num_threads() 1
 #endif
+// Vectorisable exp, log, log10 and pow in the C kernels, see vec_math.h
+#if defined(PYJAC_VEC_MATH) && !defined(__cplusplus)
+ #include "vec_math.h"
+ #define exp(x) vm_exp(x)
+ #define log(x) vm_log(x)
+ #define log10(x) vm_log10(x)
+ #define pow(x, y) vm_pow(x, y)
+#endif
 #endif
@@ -0,0 +1,32 @@
+#include "header.h"
+#include "jacob.h"
+#include "jacob_batch.h"
+
+void eval_jacob_batch (const int n_cells, const double t,
+                       const double * __restrict__ pres,
+                       const double * __restrict__ y, const int y_stride,
+                       double * __restrict__ jac, const int jac_stride,
+                       const int n_threads) {
+
+  (void) n_threads;
+
+#ifdef PYJAC_JACOB_BATCH
+  #ifdef _OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static)
+  #endif
+  for (int b = 0; b < n_cells; b += JACOB_BATCH) {
+    const int n = n_cells - b < JACOB_BATCH ? n_cells - b : JACOB_BATCH;
+    eval_jacob_block (n, t, &pres[b], &y[(size_t)b * y_stride], y_stride,
+                      &jac[(size_t)b * jac_stride], jac_stride);
+  }
+#else
+  #ifdef _OPENMP
+  #pragma omp parallel for num_threads(n_threads) schedule(static)
+  #endif
+  for (int k = 0; k < n_cells; ++k) {
+    eval_jacob (t, pres[k], &y[(size_t)k * y_stride], &jac[(size_t)k * jac_stride]);
+  }
+#endif
+
+} // end eval_jacob_batch
+
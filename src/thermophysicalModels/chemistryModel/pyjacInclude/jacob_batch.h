@@ -0,0 +1,51 @@
+#ifndef JACOB_BATCH_HEAD
+#define JACOB_BATCH_HEAD
+
+#include "header.h"
+
+/** Number of entries of the Jacobian of one state */
+#define JAC_SIZE (NSP * NSP)
+
+/** Number of states evaluated together by the batch-major kernels */
+#ifndef JACOB_BATCH
+#define JACOB_BATCH 8
+#endif
+
+/**
+ * Evaluate the Jacobians of n_cells states.
+ *
+ * The state of cell k is y[k * y_stride .. k * y_stride + NN - 1] (T then
+ * the NSP mass fractions, as for eval_jacob) at the pressure
+ * pres[k].  Its column-major Jacobian is written to
+ * jac[k * jac_stride .. k * jac_stride + JAC_SIZE - 1].  The strides allow
+ * the states to be read in place from a packed cell buffer, and must be at
+ * least NN and JAC_SIZE.
+ *
+ * Compiled with -DPYJAC_JACOB_BATCH the cells are evaluated in blocks of
+ * JACOB_BATCH by eval_jacob_block, whose sub-kernels loop over the states
+ * of the block and vectorise; the pyJac library must then include the
+ * jacob_block.c and jacobs/jacob_*_batch.c generated by batchJacob.py.
+ * Otherwise eval_jacob is called for each cell.
+ *
+ * The cells (blocks) are distributed over n_threads OpenMP threads; the
+ * chemistry model evaluates each block of cells it integrates with
+ * n_threads = 1 from within its own parallel region.
+ */
+void eval_jacob_batch (const int n_cells, const double t,
+                       const double * __restrict__ pres,
+                       const double * __restrict__ y, const int y_stride,
+                       double * __restrict__ jac, const int jac_stride,
+                       const int n_threads);
+
+#ifdef PYJAC_JACOB_BATCH
+/**
+ * Evaluate the Jacobians of n <= JACOB_BATCH states, as eval_jacob_batch.
+ * Generated by batchJacob.py.
+ */
+void eval_jacob_block (const int n, const double t,
+                       const double * __restrict__ pres,
+                       const double * __restrict__ y, const int y_stride,
+                       double * __restrict__ jac, const int jac_stride);
+#endif
+
+#endif
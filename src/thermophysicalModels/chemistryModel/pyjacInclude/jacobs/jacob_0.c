@@ -1,9 +1,14 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_0 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
   double conc_temp;
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#else
   double logT = log(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -17,6 +22,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[4] = j_temp * 3.1998799999999999e+01;
 
   //partial of rxn 0 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[0];
+#else
   if (T <= 1000.0) {
     Kc = (2.1078866500000002e+00 + -1.5540778400000002e+00 * logT + T * (1.7809517600000000e-03 + T * (-5.7313765166666677e-07 + T * (2.1456978249999992e-10 + -4.9079552499999993e-14 * T))) - -5.9308461960000001e+04 / T);
   } else {
@@ -24,9 +32,14 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[0] - rev_rates[0]);
   j_temp = -mw_avg * rho_inv * pres_mod[0] * (3.0 * fwd_rates[0] - 2.0 * rev_rates[0]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[35];
+#else
   kf = exp(2.5510757579728459e+01 - 1.0 * logT);
+#endif
   kr = kf / Kc;
   jac[56] =  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01 + 2.3280389298294963e+00 * pres_mod_temp);
   jac[57] =  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01 + 2.3280389298294963e+00 * pres_mod_temp);
@@ -140,6 +153,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] = j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 1 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[1];
+#else
   if (T <= 1000.0) {
     Kc = (-3.2924395000000217e-02 + -6.7625167000000008e-01 * logT + T * (4.3900065964733344e-04 + T * (-3.3752092466734670e-07 + T * (1.8724440897493195e-10 + -3.7427250453613386e-14 * T))) - -5.0980838539999997e+04 / T);
   } else {
@@ -147,9 +163,14 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[1] - rev_rates[1]);
   j_temp = -mw_avg * rho_inv * pres_mod[1] * (3.0 * fwd_rates[1] - 2.0 * rev_rates[1]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[36];
+#else
   kf = exp(2.6937873935368604e+01 - 1.0 * logT);
+#endif
   kr = kf / Kc;
   jac[55] =  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -316,6 +337,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 2 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[2];
+#else
   if (T <= 1000.0) {
     Kc = (-4.2649692190000001e+00 + 9.7941720999999982e-01 * logT + T * (-3.5512597146473328e-03 + T * (2.9088375746673469e-06 + T * (-1.4925230406415989e-09 + 3.3137862995361342e-13 * T))) - 8.8441643299999987e+02 / T);
   } else {
@@ -323,8 +347,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[2] - 2.0 * rev_rates[2]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[37];
+#else
   kf = exp(3.6558396000357360e+00 + 2.7 * logT - (3.1501544760183588e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] =  -(j_temp * 9.2803892982949643e-01 + kf * conc[2]);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + kf * conc[2]);
@@ -543,6 +572,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] = -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 3 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[3];
+#else
   if (T <= 1000.0) {
     Kc = (-2.5192523180000004e+00 + 3.0440668000000004e-01 * logT + T * (1.3151938349999998e-03 + T * (-2.2226854399999996e-06 + T * (1.4035022683333334e-09 + -3.3985339400000004e-13 * T))) - -2.6865930240000002e+04 / T);
   } else {
@@ -550,6 +582,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[3] - 2.0 * rev_rates[3]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -770,6 +803,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[8] = -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 4 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[4];
+#else
   if (T <= 1000.0) {
     Kc = (-2.7236808580000003e+00 + 8.4943364999999993e-01 * logT + T * (-1.6641483864999998e-03 + T * (3.9993224166666590e-07 + T * (-3.7697932500000234e-11 + -4.0418699999999293e-15 * T))) - -7.5097885000000024e+03 / T);
   } else {
@@ -777,8 +813,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[4] - 2.0 * rev_rates[4]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[38];
+#else
   kf = exp(9.1726385047921717e+00 + 2.0 * logT - (2.0128782594366510e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -997,6 +1038,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] = j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 5 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[5];
+#else
   if (T <= 1000.0) {
     Kc = (-4.9566783299999972e-01 + -5.7855027999999953e-01 * logT + T * (1.1725648098526663e-03 + T * (-6.5620983033265317e-07 + T * (3.2274157135840136e-10 + -8.0549676996386610e-14 * T))) - -8.8789978699999992e+04 / T);
   } else {
@@ -1004,6 +1048,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[5] - 2.0 * rev_rates[5]);
   kf = 57000000000.0;
   kr = kf / Kc;
@@ -1224,6 +1269,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[11] = -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 6 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[6];
+#else
   if (T <= 1000.0) {
     Kc = (-4.5701580300000000e-01 + -2.0975992999999971e-01 * logT + T * (-4.6673931114733357e-04 + T * (7.2366370466734677e-07 + T * (-2.7795262730826530e-10 + 2.6880587453613394e-14 * T))) - -4.5813074439999997e+04 / T);
   } else {
@@ -1231,6 +1279,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[6] - 2.0 * rev_rates[6]);
   kf = 80000000000.0;
   kr = kf / Kc;
@@ -1451,6 +1500,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 7 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[7];
+#else
   if (T <= 1000.0) {
     Kc = (4.3516116449999993e+00 + -1.4430066199999998e+00 * logT + T * (6.5080500499999994e-03 + T * (-5.5562271383333331e-06 + T * (2.8233701111666665e-09 + -6.1681745944999994e-13 * T))) - -9.4881096672999993e+04 / T);
   } else {
@@ -1458,6 +1510,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[7] - 2.0 * rev_rates[7]);
   kf = 15000000000.0;
   kr = kf / Kc;
@@ -1678,6 +1731,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 8 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[8];
+#else
   if (T <= 1000.0) {
     Kc = (2.3105604539999995e+00 + -6.4568536999999937e-01 * logT + T * (1.2010038553526665e-03 + T * (-1.8268026033265306e-07 + T * (-4.1515270641598609e-11 + 1.4094078453613389e-14 * T))) - -5.0305850640000004e+04 / T);
   } else {
@@ -1685,6 +1741,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[8] - 2.0 * rev_rates[8]);
   kf = 15000000000.0;
   kr = kf / Kc;
@@ -1905,6 +1962,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[18] = j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 9 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[9];
+#else
   if (T <= 1000.0) {
     Kc = (-3.9522333929999998e+00 + 4.5186564999999979e-01 * logT + T * (-4.3199832996473333e-03 + T * (4.1581197130006792e-06 + T * (-2.0774404673082654e-09 + 4.2603740745361341e-13 * T))) - -3.4402554800000005e+04 / T);
   } else {
@@ -1912,6 +1972,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[9] - 2.0 * rev_rates[9]);
   kf = 50600000000.0;
   kr = kf / Kc;
@@ -2132,6 +2193,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[14] = -j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 10 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[10];
+#else
   if (T <= 1000.0) {
     Kc = (4.7425465719999984e+00 + -6.5253739999999993e-01 * logT + T * (8.2799659349999995e-03 + T * (-7.5791611483333340e-06 + T * (3.6541717716666670e-09 + -7.4370416350000000e-13 * T))) - 1.1844677600000014e+03 / T);
   } else {
@@ -2139,8 +2203,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[10] - 2.0 * rev_rates[10]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[39];
+#else
   kf = exp(1.3835313185260453e+01 + 1.5 * logT - (4.3276882577888000e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2360,6 +2429,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[16] = j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 11 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[11];
+#else
   if (T <= 1000.0) {
     Kc = (8.7317365300000009e+00 + -3.3910270499999999e+00 * logT + T * (6.4371346450000002e-03 + T * (-2.4639068299999998e-06 + T * (6.4002088133333328e-10 + -6.7596737949999993e-14 * T))) - -6.3150142900000006e+04 / T);
   } else {
@@ -2367,10 +2439,15 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr))) * (fwd_rates[11] - rev_rates[11]);
   j_temp = -mw_avg * rho_inv * pres_mod[2] * (2.0 * fwd_rates[11] - rev_rates[11] + pres_mod_temp);
   pres_mod_temp *= exp(3.5098856874126563e+00 - (3.0948003238838510e+02 / T)) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[40];
+#else
   kf = exp(1.6705882315860439e+01 - (1.2001786621891031e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[68] +=  -1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -2537,6 +2614,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 12 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[12];
+#else
   if (T <= 1000.0) {
     Kc = (-2.2239180279999999e+00 + 1.8209595999999983e-01 * logT + T * (1.7557864800000003e-03 + T * (-2.4647093033333336e-06 + T * (1.3723623411666664e-09 + -2.9953290794999994e-13 * T))) - -4.3690829600000005e+04 / T);
   } else {
@@ -2544,6 +2624,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[12] - 2.0 * rev_rates[12]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2764,6 +2845,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 13 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[13];
+#else
   if (T <= 1000.0) {
     Kc = (6.5407428970000012e+00 + -2.5326794200000005e+00 * logT + T * (7.7539204653526671e-03 + T * (-4.5910952086659860e-06 + T * (1.8251388135250679e-09 + -3.2970239544638660e-13 * T))) - -5.5860133960000006e+04 / T);
   } else {
@@ -2771,6 +2855,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[13] - 2.0 * rev_rates[13]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2991,6 +3076,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 14 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[14];
+#else
   if (T <= 1000.0) {
     Kc = (3.8448959199999955e-01 + 2.5121102000000040e-01 * logT + T * (3.7712048449999999e-03 + T * (-4.2611969583333330e-06 + T * (2.2384208091666663e-09 + -4.7940607800000004e-13 * T))) - -7.3586569799999979e+03 / T);
   } else {
@@ -2998,8 +3086,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[14] - 2.0 * rev_rates[14]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[41];
+#else
   kf = exp(2.4386827483076058e+01 - (1.7813972596014362e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  -1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3218,6 +3311,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 15 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[15];
+#else
   if (T <= 1000.0) {
     Kc = (-8.7796507480000017e+00 + 1.7535822999999997e+00 * logT + T * (-7.3135277050000004e-03 + T * (4.8940262233333329e-06 + T * (-2.1023659991666664e-09 + 4.0295237050000001e-13 * T))) - -3.6622221669999999e+04 / T);
   } else {
@@ -3225,6 +3321,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[15] - 2.0 * rev_rates[15]);
   kf = 10000000000.0;
   kr = kf / Kc;
@@ -3445,6 +3542,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 16 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[16];
+#else
   if (T <= 1000.0) {
     Kc = (-1.8216490497999999e+01 + 3.5112674799999999e+00 * logT + T * (-8.1234636850000003e-03 + T * (4.9930672083333330e-06 + T * (-2.3586630991666664e-09 + 5.1765550950000007e-13 * T))) - -4.0794736440000001e+04 / T);
   } else {
@@ -3452,6 +3552,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[16] - 2.0 * rev_rates[16]);
   kf = 10000000000.0;
   kr = kf / Kc;
@@ -3672,6 +3773,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 17 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[17];
+#else
   if (T <= 1000.0) {
     Kc = (5.8490200520000011e+00 + -1.0277583099999998e+00 * logT + T * (1.0852818630000000e-02 + T * (-1.0222753856666668e-05 + T * (5.2395350508333331e-09 + -1.1257071015000000e-12 * T))) - -3.0583267100000035e+03 / T);
   } else {
@@ -3679,8 +3783,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[17] - 2.0 * rev_rates[17]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[42];
+#else
   kf = exp(5.9610053396232736e+00 + 2.5 * logT - (1.5599806510634046e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[72] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3899,6 +4008,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 18 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[18];
+#else
   if (T <= 1000.0) {
     Kc = (1.5285859802000001e+01 + -2.7854434900000009e+00 * logT + T * (1.1662754609999999e-02 + T * (-1.0321794841666669e-05 + T * (5.4958321508333335e-09 + -1.2404102404999998e-12 * T))) - 1.1141880599999981e+03 / T);
   } else {
@@ -3906,8 +4018,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[18] - 2.0 * rev_rates[18]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[43];
+#else
   kf = exp(4.8675344504555822e+00 + 2.5 * logT - (2.5160978242958136e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[73] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4126,6 +4243,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 19 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[19];
+#else
   if (T <= 1000.0) {
     Kc = (-3.6939031699999996e+00 + 1.0114256899999998e+00 * logT + T * (-5.2085801994999998e-03 + T * (3.5269516366666668e-06 + T * (-1.6068215921666669e-09 + 3.2549881104999994e-13 * T))) - -3.9508445000000007e+04 / T);
   } else {
@@ -4133,6 +4253,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[19] - 2.0 * rev_rates[19]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -4353,6 +4474,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[23] = -j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 20 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[20];
+#else
   if (T <= 1000.0) {
     Kc = (-4.7226776189999988e+00 + 7.7477320600000010e-01 * logT + T * (-1.2136115296473345e-03 + T * (8.5750275633401398e-07 + T * (-3.8428487147493192e-10 + 6.6079446453613315e-14 * T))) - -1.0018131000000001e+04 / T);
   } else {
@@ -4360,8 +4484,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[20] - 2.0 * rev_rates[20]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[44];
+#else
   kf = exp(9.5104449644265205e+00 + 2.0 * logT - (9.5611717323240919e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4580,6 +4709,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[23] += -j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 21 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[21];
+#else
   if (T <= 1000.0) {
     Kc = (-1.2777324203999999e+01 + 2.9047245659999996e+00 * logT + T * (-4.5368002400000005e-03 + T * (8.3585097499999963e-07 + T * (3.0923280916666690e-10 + -1.5904831849999996e-13 * T))) - 1.4903233860000008e+04 / T);
   } else {
@@ -4587,8 +4719,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[21] - 2.0 * rev_rates[21]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[45];
+#else
   kf = exp(3.8367417791399781e+01 - 1.41 * logT - (1.4568206402672762e+04 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4807,6 +4944,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 22 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[22];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4285961375999999e+01 + 3.3652639459999998e+00 * logT + T * (-9.8618627985000012e-03 + T * (5.4476383800000000e-06 + T * (-2.0692569255000003e-09 + 3.5855313605000001e-13 * T))) - -2.3891285800000001e+04 / T);
   } else {
@@ -4814,8 +4954,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[22] - 2.0 * rev_rates[22]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[46];
+#else
   kf = exp(8.8450570535008506e+00 + 2.0 * logT - (9.5611717323240919e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5034,6 +5179,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[24] = -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 23 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[23];
+#else
   if (T <= 1000.0) {
     Kc = (2.9513886870000006e+00 + -1.7448972500000002e+00 * logT + T * (9.9416996603526649e-03 + T * (-8.3264587603326529e-06 + T * (4.2698188851917346e-09 + -9.4211615804638651e-13 * T))) - -4.5551364140000005e+04 / T);
   } else {
@@ -5041,6 +5189,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[23] - 2.0 * rev_rates[23]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -5261,6 +5410,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 24 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[24];
+#else
   if (T <= 1000.0) {
     Kc = (-1.9176353200000000e+00 + 7.6730766000000061e-01 * logT + T * (4.8084338700000000e-03 + T * (-7.3719883333333327e-06 + T * (4.5917798324999999e-09 + -1.1109775509999999e-12 * T))) - -1.3927471369999999e+04 / T);
   } else {
@@ -5268,8 +5420,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[24] - 2.0 * rev_rates[24]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[47];
+#else
   kf = exp(9.4334839232903924e+00 + 1.83 * logT - (1.1070830426901580e+02 / T));
+#endif
   kr = kf / Kc;
   jac[78] =  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5488,6 +5645,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 25 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[25];
+#else
   if (T <= 1000.0) {
     Kc = (-5.5443462400000003e+00 + 9.9258077000000000e-01 * logT + T * (-2.1573708999999934e-04 + T * (-2.2175208833333329e-06 + T * (1.7700855408333336e-09 + -4.7212187849999997e-13 * T))) - -3.9827843600000000e+04 / T);
   } else {
@@ -5495,6 +5655,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[25] - 2.0 * rev_rates[25]);
   kf = 22400000000.0;
   kr = kf / Kc;
@@ -5715,6 +5876,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 26 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[26];
+#else
   if (T <= 1000.0) {
     Kc = (-9.5426192799999976e-01 + 8.3878908999999968e-01 * logT + T * (1.0964775499999995e-03 + T * (-2.0424456083333341e-06 + T * (1.0984084008333341e-09 + -2.2831108549999995e-13 * T))) - -1.1433466400000002e+03 / T);
   } else {
@@ -5722,8 +5886,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[26] - 2.0 * rev_rates[26]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[48];
+#else
   kf = exp(1.1405340254290291e+01 + 1.92 * logT - (2.8633193240486362e+03 / T));
+#endif
   kr = kf / Kc;
   jac[79] +=  1.4416383911740777e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5942,6 +6111,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.0 * 2.8010399999999997e+01;
 
   //partial of rxn 27 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[27];
+#else
   if (T <= 1000.0) {
     Kc = (-1.2211293192999999e+01 + 3.2390784399999997e+00 * logT + T * (-7.7982047596473333e-03 + T * (3.1866109496673467e-06 + T * (-7.7780674914159882e-10 + 5.7248619553613431e-14 * T))) - -5.2396220300000001e+04 / T);
   } else {
@@ -5949,6 +6121,7 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[27] - 3.0 * rev_rates[27]);
   kf = 100000000000.0;
   kr = kf / Kc;
@@ -6169,6 +6342,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 28 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[28];
+#else
   if (T <= 1000.0) {
     Kc = (-2.8207233480000005e+00 + 9.3963343000000021e-01 * logT + T * (2.0707511000000035e-04 + T * (-1.3932465250000002e-06 + T * (8.4822635250000012e-10 + -1.9002249800000002e-13 * T))) - 1.5951883999999995e+03 / T);
   } else {
@@ -6176,8 +6352,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[28] - 2.0 * rev_rates[28]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[49];
+#else
   kf = exp(2.3025850929940457e+01 - (4.0257565188733020e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[81] +=  2.0353066650792705e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6396,6 +6577,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 29 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[29];
+#else
   if (T <= 1000.0) {
     Kc = (-3.6193461800000000e+00 + 8.1534879000000027e-01 * logT + T * (-2.4430421734999994e-03 + T * (1.0705031933333333e-06 + T * (-3.8396922916666677e-10 + 7.2281704100000002e-14 * T))) - -2.4447270760000003e+04 / T);
   } else {
@@ -6403,8 +6587,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[29] - 2.0 * rev_rates[29]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[50];
+#else
   kf = exp(2.1282881624881835e+01 - (6.7934641255986969e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6623,6 +6812,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 30 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[30];
+#else
   if (T <= 1000.0) {
     Kc = (6.6238498799999999e+00 + -1.8369492099999998e+00 * logT + T * (4.6561828850000004e-03 + T * (-1.8907691783333333e-06 + T * (4.2545109883333335e-10 + -1.8517185450000006e-14 * T))) - -3.8416809400000056e+03 / T);
   } else {
@@ -6630,8 +6822,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[30] - 2.0 * rev_rates[30]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[51];
+#else
   kf = exp(2.1639556568820566e+01 - (2.4053895200267980e+04 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6850,6 +7047,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 31 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[31];
+#else
   if (T <= 1000.0) {
     Kc = (2.9037419099999999e+00 + -5.3195659999999645e-02 * logT + T * (2.4560110100000001e-03 + T * (-2.0385115183333330e-06 + T * (8.3491854083333272e-10 + -1.3955268399999999e-13 * T))) - 1.9507273260000002e+04 / T);
   } else {
@@ -6857,8 +7057,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[31] - 2.0 * rev_rates[31]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[52];
+#else
   kf = exp(2.5328436022934504e+01 - (2.0128782594366508e+04 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  -1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7076,6 +7281,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 32 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[32];
+#else
   if (T <= 1000.0) {
     Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
   } else {
@@ -7083,9 +7291,14 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[32] - rev_rates[32]);
   j_temp = -mw_avg * rho_inv * pres_mod[3] * (3.0 * fwd_rates[32] - 2.0 * rev_rates[32]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[53];
+#else
   kf = exp(2.8660640533109706e+01 - 0.86 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + pres_mod_temp);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01 + pres_mod_temp);
@@ -7251,6 +7464,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 33 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[32];
+#else
   if (T <= 1000.0) {
     Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
   } else {
@@ -7258,8 +7474,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[33] - 2.0 * rev_rates[33]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[54];
+#else
   kf = exp(3.0665974102635822e+01 - 1.24 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7425,6 +7646,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 34 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[32];
+#else
   if (T <= 1000.0) {
     Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
   } else {
@@ -7432,8 +7656,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[34] - 2.0 * rev_rates[34]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[55];
+#else
   kf = exp(3.0052277738640093e+01 - 0.76 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7599,6 +7828,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 35 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[32];
+#else
   if (T <= 1000.0) {
     Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
   } else {
@@ -7606,8 +7838,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[35] - 2.0 * rev_rates[35]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[56];
+#else
   kf = exp(3.0889117653950031e+01 - 1.24 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[1] * conc[3] - kr * conc[6]));
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[1] * conc[3] - kr * conc[6]));
@@ -7773,6 +8010,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 36 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[32];
+#else
   if (T <= 1000.0) {
     Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
   } else {
@@ -7780,8 +8020,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[36] - 2.0 * rev_rates[36]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[57];
+#else
   kf = exp(2.7274346171989816e+01 - 0.8 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7948,6 +8193,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 37 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[33];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1408110450000004e+00 + 8.7782617000000007e-01 * logT + T * (-1.3419511003526666e-03 + T * (2.3561672699932007e-07 + T * (-2.7325373525067973e-11 + 1.1652302046386607e-14 * T))) - 8.3276234200000017e+03 / T);
   } else {
@@ -7955,8 +8203,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[37] - 2.0 * rev_rates[37]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[58];
+#else
   kf = exp(3.0908165848920724e+01 - 0.6707 * logT - (8.5753646047649927e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -8173,6 +8426,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * -2.0 * 1.0079400000000001e+00;
 
   //partial of rxn 38 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[34];
+#else
   if (T <= 1000.0) {
     Kc = (4.2320448239999999e+00 + -1.6556688799999999e+00 * logT + T * (3.9902603742946671e-03 + T * (-3.2463584993346931e-06 + T * (1.6797674496165307e-09 + -3.6880588040722682e-13 * T))) - -5.1865254972999996e+04 / T);
   } else {
@@ -8180,9 +8436,14 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[38] - rev_rates[38]);
   j_temp = -mw_avg * rho_inv * pres_mod[4] * (3.0 * fwd_rates[38] - 2.0 * rev_rates[38]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[59];
+#else
   kf = exp(2.7631021115928547e+01 - 1.0 * logT);
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 + -7.1961070170503627e-02 * pres_mod_temp + pres_mod[4] * (-kr));
   jac[55] +=  -(j_temp * 9.2803892982949643e-01 + -7.1961070170503627e-02 * pres_mod_temp + pres_mod[4] * (-kr));
@@ -8295,6 +8556,9 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * -2.0 * 1.0079400000000001e+00;
 
   //partial of rxn 39 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[34];
+#else
   if (T <= 1000.0) {
     Kc = (4.2320448239999999e+00 + -1.6556688799999999e+00 * logT + T * (3.9902603742946671e-03 + T * (-3.2463584993346931e-06 + T * (1.6797674496165307e-09 + -3.6880588040722682e-13 * T))) - -5.1865254972999996e+04 / T);
   } else {
@@ -8302,8 +8566,13 @@ void eval_jacob_0 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[39] - 2.0 * rev_rates[39]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[60];
+#else
   kf = exp(2.5223075507276675e+01 - 0.6 * logT);
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 + kf * conc[1] * conc[1] - kr * 2.0 * conc[0]);
   jac[55] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[1] * conc[1] - kr * 2.0 * conc[0]);
@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_1 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -21,6 +25,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * -2.0 * 1.0079400000000001e+00;
 
   //partial of rxn 40 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[34];
+#else
   if (T <= 1000.0) {
     Kc = (4.2320448239999999e+00 + -1.6556688799999999e+00 * logT + T * (3.9902603742946671e-03 + T * (-3.2463584993346931e-06 + T * (1.6797674496165307e-09 + -3.6880588040722682e-13 * T))) - -5.1865254972999996e+04 / T);
   } else {
@@ -28,8 +35,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[40] - 2.0 * rev_rates[40]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[99];
+#else
   kf = exp(3.1725365678150649e+01 - 1.25 * logT);
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[5]);
   jac[55] +=  -(j_temp * 9.2803892982949643e-01 - kr * conc[5]);
@@ -142,6 +154,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * -2.0 * 1.0079400000000001e+00;
 
   //partial of rxn 41 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[34];
+#else
   if (T <= 1000.0) {
     Kc = (4.2320448239999999e+00 + -1.6556688799999999e+00 * logT + T * (3.9902603742946671e-03 + T * (-3.2463584993346931e-06 + T * (1.6797674496165307e-09 + -3.6880588040722682e-13 * T))) - -5.1865254972999996e+04 / T);
   } else {
@@ -149,8 +164,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (3.0 * fwd_rates[41] - 2.0 * rev_rates[41]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[100];
+#else
   kf = exp(3.3940939394155066e+01 - 2.0 * logT);
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[15]);
   jac[55] +=  -(j_temp * 9.2803892982949643e-01 - kr * conc[15]);
@@ -264,6 +284,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[6] = j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 42 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[61];
+#else
   if (T <= 1000.0) {
     Kc = (1.9949509729999999e+00 + -1.2933748700000001e+00 * logT + T * (1.8244170964733350e-04 + T * (3.1707728366598661e-07 + T * (-1.3390310769173469e-10 + 2.0393173546386613e-14 * T))) - -5.9382467160000000e+04 / T);
   } else {
@@ -271,9 +294,14 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[42] - rev_rates[42]);
   j_temp = -mw_avg * rho_inv * pres_mod[5] * (3.0 * fwd_rates[42] - 2.0 * rev_rates[42]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[101];
+#else
   kf = exp(3.7629818848269004e+01 - 2.0 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 6.5803892982949641e-01 * pres_mod_temp);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01 + 6.5803892982949641e-01 * pres_mod_temp);
@@ -440,6 +468,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 43 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[62];
+#else
   if (T <= 1000.0) {
     Kc = (-2.6321879950000002e+00 + 5.6510965000000057e-01 * logT + T * (-2.8331621535266673e-04 + T * (-1.3324705046673464e-06 + T * (1.0550293781415989e-09 + -2.7038066795361348e-13 * T))) - -2.6939935439999997e+04 / T);
   } else {
@@ -447,8 +478,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[43] - 2.0 * rev_rates[43]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[102];
+#else
   kf = exp(2.2102031931645509e+01 - (3.3766032802049818e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -667,6 +703,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 44 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[63];
+#else
   if (T <= 1000.0) {
     Kc = (1.7457169009999998e+00 + -6.7501052999999978e-01 * logT + T * (4.8664535496473326e-03 + T * (-5.1315230146673465e-06 + T * (2.8960253089749321e-09 + -6.7123202395361341e-13 * T))) - -2.7750346673000000e+04 / T);
   } else {
@@ -674,8 +713,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[44] - 2.0 * rev_rates[44]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[103];
+#else
   kf = exp(2.4525473976367351e+01 - (5.3743849526958581e+02 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[3]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[3]);
@@ -893,6 +937,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 45 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[64];
+#else
   if (T <= 1000.0) {
     Kc = (-4.6600633630000008e+00 + 1.1822328500000001e+00 * logT + T * (-2.6757265352666572e-05 + T * (-1.9870687130006796e-06 + T * (1.3761768948082653e-09 + -3.2820109195361345e-13 * T))) - -1.8538306819999998e+04 / T);
   } else {
@@ -900,8 +947,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[45] - 2.0 * rev_rates[45]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[104];
+#else
   kf = exp(2.5154082635789724e+01 - (3.1954442368556835e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  1.6873365478103853e+01 * (j_temp * 9.2803892982949643e-01);
@@ -1068,6 +1120,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 46 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[65];
+#else
   if (T <= 1000.0) {
     Kc = (1.5412883609999999e+00 + -1.2998355999999989e-01 * logT + T * (1.8871113281473330e-03 + T * (-2.5089053330006806e-06 + T * (1.4548251081415985e-09 + -3.3542049995361335e-13 * T))) - -8.3942049330000009e+03 / T);
   } else {
@@ -1075,8 +1130,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[46] - 2.0 * rev_rates[46]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[105];
+#else
   kf = exp(9.4009607315848331e+00 + 2.0 * logT - (2.6167417372676464e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[6]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[6]);
@@ -1295,6 +1355,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 47 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[66];
+#else
   if (T <= 1000.0) {
     Kc = (-5.3558688530000005e+00 + 1.4145433000000001e+00 * logT + T * (-1.9474646018526665e-03 + T * (-9.3253826300068034e-07 + T * (1.0173314456415985e-09 + -2.7442253795361340e-13 * T))) - -3.4449723939999996e+04 / T);
   } else {
@@ -1302,8 +1365,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[47] - 2.0 * rev_rates[47]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[106];
+#else
   kf = exp(2.3025850929940457e+01 - (1.8115904334929860e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1522,6 +1590,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[1] += j_temp * 2.0158800000000001e+00;
 
   //partial of rxn 48 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[67];
+#else
   if (T <= 1000.0) {
     Kc = (4.6682364710000002e+00 + -1.0912459799999996e+00 * logT + T * (3.6675737421473331e-03 + T * (-2.8425613505006798e-06 + T * (1.3552334365582654e-09 + -2.8517527465361342e-13 * T))) - -1.1745005272999997e+04 / T);
   } else {
@@ -1529,6 +1600,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[48] - 2.0 * rev_rates[48]);
   kf = 165000000000.0;
   kr = kf / Kc;
@@ -1754,6 +1826,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 49 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[68];
+#else
   if (T <= 1000.0) {
     Kc = (3.0778036030000000e+00 + -1.5890882699999995e+00 * logT + T * (5.2103980314733363e-04 + T * (4.8922002533265336e-07 + T * (-2.5168856019173461e-10 + 4.2822007546386620e-14 * T))) - -5.5032701199999996e+04 / T);
   } else {
@@ -1761,6 +1836,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[49] - rev_rates[49]);
   j_temp = -mw_avg * rho_inv * pres_mod[6] * (2.0 * fwd_rates[49] - rev_rates[49] + pres_mod_temp);
   pres_mod_temp *= exp(1.8970727080871637e+01 - 2.76 * logT - (8.0515130377466039e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
@@ -1931,6 +2007,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[10] += j_temp * 1.3018939999999999e+01;
 
   //partial of rxn 50 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[69];
+#else
   if (T <= 1000.0) {
     Kc = (4.8472794779999990e+00 + -8.6445633999999982e-01 * logT + T * (5.3354852401473326e-03 + T * (-4.9000173080006804e-06 + T * (2.5006285398082657e-09 + -5.3626778245361345e-13 * T))) - -6.0911179730000003e+03 / T);
   } else {
@@ -1938,6 +2017,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[50] - 2.0 * rev_rates[50]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2163,6 +2243,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[14] += j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 51 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[70];
+#else
   if (T <= 1000.0) {
     Kc = (-4.7754709669999986e+00 + -2.3714270000000148e-02 * logT + T * (-7.8409652753526661e-03 + T * (7.2416402236659866e-06 + T * (-3.4669273626917350e-09 + 7.0627691304638665e-13 * T))) - -5.2165306299999997e+04 / T);
   } else {
@@ -2170,10 +2253,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[51] - rev_rates[51]);
   j_temp = -mw_avg * rho_inv * pres_mod[7] * (2.0 * fwd_rates[51] - rev_rates[51] + pres_mod_temp);
   pres_mod_temp *= exp(3.2870061872547048e+01 - 4.226 * logT - (9.5813005149184596e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[107];
+#else
   kf = exp(3.0262909956065194e+01 - 0.534 * logT - (2.6972568676451124e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[66] +=  -7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -2340,6 +2428,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[14] += -j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 52 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[71];
+#else
   if (T <= 1000.0) {
     Kc = (9.0075157909999994e+00 + -1.6319546099999998e+00 * logT + T * (1.1831225649647333e-02 + T * (-1.0487998723000679e-05 + T * (5.1466948123082656e-09 + -1.0750827934536134e-12 * T))) - 3.0005132700000104e+02 / T);
   } else {
@@ -2347,8 +2438,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[52] - 2.0 * rev_rates[52]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[108];
+#else
   kf = exp(1.3399995114002609e+01 + 1.62 * logT - (5.4549000830733239e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[12]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[12]);
@@ -2572,6 +2668,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 53 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[72];
+#else
   if (T <= 1000.0) {
     Kc = (-4.1741398699999976e-01 + -9.2746269000000048e-01 * logT + T * (-3.3322041853526664e-03 + T * (3.9236760336659856e-06 + T * (-2.0511764001917343e-09 + 4.4197882754638664e-13 * T))) - -4.3622181559999997e+04 / T);
   } else {
@@ -2579,10 +2678,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[53] - rev_rates[53]);
   j_temp = -mw_avg * rho_inv * pres_mod[8] * (2.0 * fwd_rates[53] - rev_rates[53] + pres_mod_temp);
   pres_mod_temp *= exp(2.1541306291345244e+01 - 3.05 * logT - (3.4470540192852650e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[109];
+#else
   kf = exp(2.0809443533187462e+01 + 0.48 * logT - (-1.3083708686338232e+02 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  -1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -2749,6 +2853,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 54 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[73];
+#else
   if (T <= 1000.0) {
     Kc = (2.0410511910000002e+00 + -7.9732125000000043e-01 * logT + T * (5.3070461946473331e-03 + T * (-5.3735468780006796e-06 + T * (2.8648853818082653e-09 + -6.3091153790361341e-13 * T))) - -4.4575246033000003e+04 / T);
   } else {
@@ -2756,6 +2863,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[54] - 2.0 * rev_rates[54]);
   kf = 73400000000.0;
   kr = kf / Kc;
@@ -2981,6 +3089,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[18] += -j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 55 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[74];
+#else
   if (T <= 1000.0) {
     Kc = (8.7467263529999997e+00 + -2.4298339699999998e+00 * logT + T * (7.7525283646473339e-03 + T * (-5.2315471480006795e-06 + T * (2.2896104081415984e-09 + -4.4037962095361341e-13 * T))) - -1.4358616870000000e+04 / T);
   } else {
@@ -2988,10 +3099,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[55] - rev_rates[55]);
   j_temp = -mw_avg * rho_inv * pres_mod[9] * (2.0 * fwd_rates[55] - rev_rates[55] + pres_mod_temp);
   pres_mod_temp *= exp(3.9999149620793091e+01 - 5.274 * logT - (1.4744333250373465e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[110];
+#else
   kf = exp(2.0107079697522593e+01 + 0.454 * logT - (1.8115904334929860e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[72] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -3162,6 +3278,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[18] += -j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 56 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[75];
+#else
   if (T <= 1000.0) {
     Kc = (1.8183566103000000e+01 + -4.1875191500000000e+00 * logT + T * (8.5624643446473338e-03 + T * (-5.3305881330006796e-06 + T * (2.5459075081415984e-09 + -5.5508275995361342e-13 * T))) - -1.0186102099999998e+04 / T);
   } else {
@@ -3169,10 +3288,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[56] - rev_rates[56]);
   j_temp = -mw_avg * rho_inv * pres_mod[10] * (2.0 * fwd_rates[56] - rev_rates[56] + pres_mod_temp);
   pres_mod_temp *= exp(3.5943419894698771e+01 - 5.254 * logT - (1.4895299119831216e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[111];
+#else
   kf = exp(2.0107079697522593e+01 + 0.454 * logT - (1.3083708686338232e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[73] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -3339,6 +3463,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[1] += j_temp * 2.0158800000000001e+00;
 
   //partial of rxn 57 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[76];
+#else
   if (T <= 1000.0) {
     Kc = (4.6494588109999997e+00 + -7.2820618999999942e-01 * logT + T * (7.3224645596473327e-03 + T * (-7.1700345330006799e-06 + T * (3.7309438498082653e-09 + -8.1078470795361340e-13 * T))) - -8.2430734129999983e+03 / T);
   } else {
@@ -3346,8 +3473,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[57] - 2.0 * rev_rates[57]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[112];
+#else
   kf = exp(1.0957799582307658e+01 + 1.9 * logT - (1.3798280468438243e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01 - kr * conc[16]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[16]);
@@ -3570,6 +3702,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[21] += j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 58 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[77];
+#else
   if (T <= 1000.0) {
     Kc = (-5.8819444470000004e+00 + 3.5150664000000020e-01 * logT + T * (-1.0413817970352667e-02 + T * (9.8852329319993209e-06 + T * (-5.0522906418584007e-09 + 1.0882798510463865e-12 * T))) - -4.7922511829999996e+04 / T);
   } else {
@@ -3577,10 +3712,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[58] - rev_rates[58]);
   j_temp = -mw_avg * rho_inv * pres_mod[11] * (2.0 * fwd_rates[58] - rev_rates[58] + pres_mod_temp);
   pres_mod_temp *= exp(3.8260292778337643e+01 - 5.15 * logT - (2.5130785069066587e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[113];
+#else
   kf = exp(2.0776806603874441e+01 + 0.5 * logT - (4.3276882577887996e+01 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[72] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -3747,6 +3887,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 59 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[78];
+#else
   if (T <= 1000.0) {
     Kc = (-4.5146815290000006e+00 + 7.7416508999999989e-01 * logT + T * (-3.7622679903526672e-03 + T * (1.9851886486659860e-06 + T * (-6.0984295852506789e-10 + 7.1573740546386646e-14 * T))) - -3.7506638103000005e+04 / T);
   } else {
@@ -3754,6 +3897,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[59] - 2.0 * rev_rates[59]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -3974,6 +4118,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 60 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[79];
+#else
   if (T <= 1000.0) {
     Kc = (-4.8274173550000006e+00 + 1.3017166499999999e+00 * logT + T * (-2.9935444053526663e-03 + T * (7.3590651033265337e-07 + T * (-2.4925531858401327e-11 + -2.3085036953613373e-14 * T))) - -2.2196668699999973e+03 / T);
   } else {
@@ -3981,8 +4128,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[60] - 2.0 * rev_rates[60]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[114];
+#else
   kf = exp(1.8921456031864853e+01 + 0.65 * logT - (-1.4291435642000221e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[72] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4201,6 +4353,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 61 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[80];
+#else
   if (T <= 1000.0) {
     Kc = (-8.6778462419999993e+00 + 2.0333554899999999e+00 * logT + T * (-4.9998856653526661e-03 + T * (1.4701077336659865e-06 + T * (-1.4357743602506805e-10 + -3.2727361953613374e-14 * T))) - -2.0766566299999977e+03 / T);
   } else {
@@ -4208,8 +4363,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[61] - 2.0 * rev_rates[61]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[115];
+#else
   kf = exp(2.4213694352336510e+01 - 0.09 * logT - (3.0696393456408930e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[72] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4432,6 +4592,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[21] += j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 62 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[81];
+#else
   if (T <= 1000.0) {
     Kc = (-1.5318784196999999e+01 + 2.1091918200000004e+00 * logT + T * (-1.1223753950352668e-02 + T * (9.9842739169993203e-06 + T * (-5.3085877418584011e-09 + 1.2029829900463866e-12 * T))) - -5.2095026599999997e+04 / T);
   } else {
@@ -4439,10 +4602,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[62] - rev_rates[62]);
   j_temp = -mw_avg * rho_inv * pres_mod[12] * (2.0 * fwd_rates[62] - rev_rates[62] + pres_mod_temp);
   pres_mod_temp *= exp(6.0518336608630285e+01 - 7.955 * logT - (7.0601704949740533e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[116];
+#else
   kf = exp(2.1611157094298868e+01 + 0.515 * logT - (2.5160978242958137e+01 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[73] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -4607,6 +4775,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[20] += -j_temp * 3.1034219999999998e+01;
 
   //partial of rxn 63 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[82];
+#else
   if (T <= 1000.0) {
     Kc = (-9.4368397500000007e+00 + 1.7576851800000002e+00 * logT + T * (-8.0993597999999990e-04 + T * (9.9040985000000045e-08 + T * (-2.5629710000000004e-10 + 1.1470313900000000e-13 * T))) - -4.1725147699999998e+03 / T);
   } else {
@@ -4614,8 +4785,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[63] - 2.0 * rev_rates[63]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[117];
+#else
   kf = exp(1.0633448706218790e+01 + 1.63 * logT - (9.6819444278902915e+02 / T));
+#endif
   kr = kf / Kc;
   jac[72] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[73] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4730,6 +4906,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 64 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[83];
+#else
   if (T <= 1000.0) {
     Kc = (-1.3951521279000000e+01 + 2.5318502700000001e+00 * logT + T * (-4.5722039703526667e-03 + T * (2.0842296336659861e-06 + T * (-8.6614005852506782e-10 + 1.8627687954638660e-13 * T))) - -4.1679152872999999e+04 / T);
   } else {
@@ -4737,6 +4916,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[64] - 2.0 * rev_rates[64]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -4957,6 +5137,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 65 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[84];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4264257104999999e+01 + 3.0594018300000001e+00 * logT + T * (-3.8034803853526662e-03 + T * (8.3494749533265330e-07 + T * (-2.8122263185840132e-10 + 9.1618102046386617e-14 * T))) - -6.3921816399999989e+03 / T);
   } else {
@@ -4964,8 +5147,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[65] - 2.0 * rev_rates[65]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[118];
+#else
   kf = exp(2.1128730945054574e+01 + 0.5 * logT - (-5.5354152134507899e+01 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[73] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5184,6 +5372,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 66 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[85];
+#else
   if (T <= 1000.0) {
     Kc = (-1.8114685991999998e+01 + 3.7910406700000001e+00 * logT + T * (-5.8098216453526660e-03 + T * (1.5691487186659867e-06 + T * (-3.9987453602506809e-10 + 8.1975777046386616e-14 * T))) - -6.2491713999999993e+03 / T);
   } else {
@@ -5191,8 +5382,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[66] - 2.0 * rev_rates[66]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[119];
+#else
   kf = exp(2.6291610340707507e+01 - 0.23 * logT - (5.3844493439930409e+02 / T));
+#endif
   kr = kf / Kc;
   jac[65] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -5411,6 +5607,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 67 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[86];
+#else
   if (T <= 1000.0) {
     Kc = (1.0113989271000001e+01 + -2.0071755200000001e+00 * logT + T * (1.4404078344647334e-02 + T * (-1.3131591431334014e-05 + T * (6.7320580914749317e-09 + -1.4570857314536132e-12 * T))) - -3.9427431429999997e+03 / T);
   } else {
@@ -5418,8 +5617,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[67] - 2.0 * rev_rates[67]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[120];
+#else
   kf = exp(9.7409686230383539e+00 + 2.1 * logT - (2.4506792808641226e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[18]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[18]);
@@ -5638,6 +5842,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 68 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[87];
+#else
   if (T <= 1000.0) {
     Kc = (1.9550829021000002e+01 + -3.7648607000000003e+00 * logT + T * (1.5214014324647333e-02 + T * (-1.3230632416334013e-05 + T * (6.9883551914749320e-09 + -1.5717888704536133e-12 * T))) - 2.2977162699999826e+02 / T);
   } else {
@@ -5645,8 +5852,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[68] - 2.0 * rev_rates[68]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[121];
+#else
   kf = exp(8.3428398042714598e+00 + 2.1 * logT - (2.4506792808641226e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[19]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[19]);
@@ -5870,6 +6082,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 69 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[88];
+#else
   if (T <= 1000.0) {
     Kc = (1.2744399808999999e+01 + -3.5809762359999997e+00 * logT + T * (4.9758008996473339e-03 + T * (-1.1733718996673462e-06 + T * (-1.2198840019173490e-10 + 1.2162106804638661e-13 * T))) - -6.5884072400000005e+04 / T);
   } else {
@@ -5877,10 +6092,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[69] - rev_rates[69]);
   j_temp = -mw_avg * rho_inv * pres_mod[13] * (2.0 * fwd_rates[69] - rev_rates[69] + pres_mod_temp);
   pres_mod_temp *= exp(3.1255362048904914e+01 - 3.8 * logT - (9.5611717323240919e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[122];
+#else
   kf = exp(3.2236191301916641e+01 - 1.0 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[75] +=  -1.2416383911740777e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6051,6 +6271,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 70 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[89];
+#else
   if (T <= 1000.0) {
     Kc = (-4.8862673529999983e+00 + 9.0378535599999998e-01 * logT + T * (-1.0923385640352666e-02 + T * (1.0239687116999320e-05 + T * (-5.3150857001917346e-09 + 1.1607908520463867e-12 * T))) - -1.7042793799999999e+04 / T);
   } else {
@@ -6058,10 +6281,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[70] - rev_rates[70]);
   j_temp = -mw_avg * rho_inv * pres_mod[14] * (2.0 * fwd_rates[70] - rev_rates[70] + pres_mod_temp);
   pres_mod_temp *= exp(5.7176861793842377e+01 - 7.27 * logT - (2.4255183026211644e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[123];
+#else
   kf = exp(2.2446032434687513e+01 - (1.2077269556619906e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[76] +=  -1.2916383911740777e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6232,6 +6460,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 71 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[90];
+#else
   if (T <= 1000.0) {
     Kc = (-2.2132614670000001e+00 + -7.5326497000000003e-01 * logT + T * (-4.5426570453526664e-03 + T * (5.1963480003326537e-06 + T * (-2.7827575501917343e-09 + 6.1366750004638666e-13 * T))) - -5.5243730769999995e+04 / T);
   } else {
@@ -6239,10 +6470,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[71] - rev_rates[71]);
   j_temp = -mw_avg * rho_inv * pres_mod[15] * (2.0 * fwd_rates[71] - rev_rates[71] + pres_mod_temp);
   pres_mod_temp *= exp(3.3070243935553819e+01 - 4.13 * logT - (1.5297874771718548e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[124];
+#else
   kf = exp(2.2528270532924488e+01 + 0.27 * logT - (1.4090147816056557e+02 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6409,6 +6645,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 72 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[91];
+#else
   if (T <= 1000.0) {
     Kc = (9.1183121770000000e+00 + -2.5594542359999997e+00 * logT + T * (1.4913646014647333e-02 + T * (-1.3486045616334013e-05 + T * (6.9948531498082656e-09 + -1.5295967324536134e-12 * T))) - -3.4822461173000003e+04 / T);
   } else {
@@ -6416,6 +6655,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[72] - 2.0 * rev_rates[72]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -6640,6 +6880,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[26] += j_temp * 2.9061699999999998e+01;
 
   //partial of rxn 73 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[92];
+#else
   if (T <= 1000.0) {
     Kc = (3.2092969330000005e+00 + -1.1527358000000003e+00 * logT + T * (1.6919667746473337e-03 + T * (-1.2307914163340125e-06 + T * (7.7051789147493195e-10 + -1.9687684495361349e-13 * T))) - -1.7721809329999996e+04 / T);
   } else {
@@ -6647,10 +6890,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[73] - rev_rates[73]);
   j_temp = -mw_avg * rho_inv * pres_mod[16] * (2.0 * fwd_rates[73] - rev_rates[73] + pres_mod_temp);
   pres_mod_temp *= exp(6.2275158026497060e+01 - 8.074 * logT - (2.5915807590246877e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[125];
+#else
   kf = exp(2.0107079697522593e+01 + 0.454 * logT - (9.1585960804367619e+02 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6817,6 +7065,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 74 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[93];
+#else
   if (T <= 1000.0) {
     Kc = (6.4453062909999996e+00 + -9.0240390999999986e-01 * logT + T * (8.5329174196473335e-03 + T * (-8.4427064996673472e-06 + T * (4.4625249998082653e-09 + -9.8247338045361357e-13 * T))) - 3.3784757969999991e+03 / T);
   } else {
@@ -6824,8 +7075,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[74] - 2.0 * rev_rates[74]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[126];
+#else
   kf = exp(7.1891677384203225e+00 + 2.53 * logT - (6.1594074738761519e+03 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 - kr * conc[23]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[23]);
@@ -7048,6 +7304,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[26] += -j_temp * 2.9061699999999998e+01;
 
   //partial of rxn 75 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[94];
+#else
   if (T <= 1000.0) {
     Kc = (9.2133753299999954e-01 + -1.5150407599999998e+00 * logT + T * (-6.5747689035266588e-04 + T * (1.7049246836659875e-06 + T * (-9.1116399185840205e-10 + 1.9088383504638650e-13 * T))) - -4.9837491899999994e+04 / T);
   } else {
@@ -7055,10 +7314,15 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[75] - rev_rates[75]);
   j_temp = -mw_avg * rho_inv * pres_mod[17] * (2.0 * fwd_rates[75] - rev_rates[75] + pres_mod_temp);
   pres_mod_temp *= exp(4.7391841735846086e+01 - 6.09 * logT - (2.5689358786060257e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[127];
+#else
   kf = exp(3.3886771157681913e+01 - 0.99 * logT - (7.9508691247747720e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[80] +=  1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -7225,6 +7489,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[25] += j_temp * 2.8053759999999997e+01;
 
   //partial of rxn 76 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[95];
+#else
   if (T <= 1000.0) {
     Kc = (1.0227478909999994e+00 + -5.0293307999999959e-01 * logT + T * (2.2982935996473334e-03 + T * (-2.0155670830006801e-06 + T * (9.0924955814159900e-10 + -1.7192903545361343e-13 * T))) - -3.4143445642999999e+04 / T);
   } else {
@@ -7232,6 +7499,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[76] - 2.0 * rev_rates[76]);
   kf = 2000000000.0;
   kr = kf / Kc;
@@ -7452,6 +7720,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[26] += j_temp * 2.9061699999999998e+01;
 
   //partial of rxn 77 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[96];
+#else
   if (T <= 1000.0) {
     Kc = (3.3107072910000004e+00 + -1.4062812000000013e-01 * logT + T * (4.6477372646473326e-03 + T * (-4.9512831830006802e-06 + T * (2.5909314414749330e-09 + -5.5968971545361342e-13 * T))) - -2.0277630730000001e+03 / T);
   } else {
@@ -7459,8 +7730,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[77] - 2.0 * rev_rates[77]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[128];
+#else
   kf = exp(1.1652687407345388e+01 + 1.9 * logT - (3.7892433233894953e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[25]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[25]);
@@ -7679,6 +7955,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 78 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[97];
+#else
   if (T <= 1000.0) {
     Kc = (-1.2330860013999999e+01 + 3.0264161799999996e+00 * logT + T * (-1.0315994435352666e-02 + T * (5.4964795886659863e-06 + T * (-1.9214094106917351e-09 + 3.0526019859638665e-13 * T))) - -9.3803786000000000e+03 / T);
   } else {
@@ -7686,6 +7965,7 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[78] - 2.0 * rev_rates[78]);
   kf = 100000000000.0;
   kr = kf / Kc;
@@ -7906,6 +8186,9 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   jac[29] += -j_temp * 4.2037279999999996e+01;
 
   //partial of rxn 79 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[98];
+#else
   if (T <= 1000.0) {
     Kc = (1.4442458709999997e+00 + -3.9783779999999602e-02 * logT + T * (3.7583348246473334e-03 + T * (-4.3020840996673466e-06 + T * (2.3407493931415991e-09 + -5.2140112795361339e-13 * T))) - 7.1077196699999968e+02 / T);
   } else {
@@ -7913,8 +8196,13 @@ void eval_jacob_1 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[79] - 2.0 * rev_rates[79]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[129];
+#else
   kf = exp(2.4635288842374557e+01 - (4.0257565188733020e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[27]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[27]);
@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_2 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -23,6 +27,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 80 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[130];
+#else
   if (T <= 1000.0) {
     Kc = (-9.2732791070000005e+00 + 2.6172875700000002e+00 * logT + T * (-8.3591370153526662e-03 + T * (4.0236300486659861e-06 + T * (-1.2756786706917347e-09 + 1.8270044959638663e-13 * T))) - -1.6329829059999996e+04 / T);
   } else {
@@ -30,8 +37,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[80] - 2.0 * rev_rates[80]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[168];
+#else
   kf = exp(2.3148068562664704e+01 - (1.7250366683372099e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[82] +=  -2.0853066650792702e+01 * (j_temp * 9.2803892982949643e-01);
@@ -248,6 +260,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[30] = -j_temp * 4.2037280000000003e+01;
 
   //partial of rxn 81 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[131];
+#else
   if (T <= 1000.0) {
     Kc = (-2.5521339999999988e+00 + 8.9346299999999990e-01 * logT + T * (-6.4766644500000008e-03 + T * (5.5786861000000013e-06 + T * (-2.8160962766666671e-09 + 6.0000089250000002e-13 * T))) - -1.5074532340000000e+04 / T);
   } else {
@@ -255,6 +270,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[81] - 2.0 * rev_rates[81]);
   kf = 10000000000.0;
   kr = kf / Kc;
@@ -376,6 +392,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += -j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 82 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[132];
+#else
   if (T <= 1000.0) {
     Kc = (-2.4584651780000000e+00 + -1.3014144000000005e-01 * logT + T * (-8.6392503799999978e-03 + T * (9.2972229116666652e-06 + T * (-4.9160617820000005e-09 + 1.0728903654500000e-12 * T))) - 9.5306447299999854e+02 / T);
   } else {
@@ -383,10 +402,15 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[82] - rev_rates[82]);
   j_temp = -mw_avg * rho_inv * pres_mod[18] * (2.0 * fwd_rates[82] - rev_rates[82] + pres_mod_temp);
   pres_mod_temp *= exp(3.9308672375802352e+01 - 4.92 * logT - (2.3902929330810221e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[169];
+#else
   kf = exp(1.0668955394675699e+01 + 1.5 * logT - (4.0056277362789355e+04 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[18] * (kf * conc[14]));
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[18] * (kf * conc[14]));
@@ -553,6 +577,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 83 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[133];
+#else
   if (T <= 1000.0) {
     Kc = (-2.2370938509999996e+00 + 3.6229401000000028e-01 * logT + T * (-3.8078186646473330e-03 + T * (3.5634357830006797e-06 + T * (-1.8136705573082654e-09 + 3.8919905395361339e-13 * T))) - -7.5172121869999974e+03 / T);
   } else {
@@ -560,8 +587,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[83] - 2.0 * rev_rates[83]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[170];
+#else
   kf = exp(1.2283033686666302e+01 + 1.51 * logT - (1.7260431074669282e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[4]);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + kf * conc[4]);
@@ -783,6 +815,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[8] += j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 84 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[134];
+#else
   if (T <= 1000.0) {
     Kc = (7.3508198260000004e+00 + -2.7079181700000001e+00 * logT + T * (2.1299063115000003e-03 + T * (1.2496155466666669e-06 + T * (-1.1512345533333333e-09 + 2.9481571150000003e-13 * T))) - -2.4932743220000000e+04 / T);
   } else {
@@ -790,10 +825,15 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[84] - rev_rates[84]);
   j_temp = -mw_avg * rho_inv * pres_mod[19] * (2.0 * fwd_rates[84] - rev_rates[84] + pres_mod_temp);
   pres_mod_temp *= exp(3.4365993087130713e+00 - 0.53 * logT - (-8.5547326026057669e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[171];
+#else
   kf = exp(2.5027330930150580e+01 - 0.37 * logT);
+#endif
   kr = kf / Kc;
   jac[58] +=  -1.6873365478103853e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[61] +=  1.6873365478103853e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -907,6 +947,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 85 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[135];
+#else
   if (T <= 1000.0) {
     Kc = (2.0278753680000001e+00 + -6.1712319999999954e-01 * logT + T * (-2.5655894999999994e-04 + T * (6.5459820833333341e-07 + T * (-3.2114751666666664e-10 + 5.7820423999999999e-14 * T))) - -8.4016286199999995e+03 / T);
   } else {
@@ -914,8 +957,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[85] - 2.0 * rev_rates[85]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[172];
+#else
   kf = exp(3.5751506887855933e+00 + 2.4 * logT - (-1.0617932818528334e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -1.6873365478103853e+01 * (j_temp * 9.2803892982949643e-01);
@@ -1082,6 +1130,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 86 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[136];
+#else
   if (T <= 1000.0) {
     Kc = (-4.9137694999999981e-01 + -3.1271651999999950e-01 * logT + T * (1.0586348849999999e-03 + T * (-1.5680872316666664e-06 + T * (1.0823547516666667e-09 + -2.8203297000000007e-13 * T))) - -3.5267558860000005e+04 / T);
   } else {
@@ -1089,8 +1140,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[86] - 2.0 * rev_rates[86]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[173];
+#else
   kf = exp(2.3397414486372941e+01 - (-2.5160978242958137e+02 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1309,6 +1365,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 87 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[137];
+#else
   if (T <= 1000.0) {
     Kc = (-6.9580548999999969e-01 + 2.3231045000000039e-01 * logT + T * (-1.9207073365000000e-03 + T * (1.0545304499999991e-06 + T * (-3.5884544916666708e-10 + 5.3778554000000095e-14 * T))) - -1.5911417119999998e+04 / T);
   } else {
@@ -1316,8 +1375,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[87] - 2.0 * rev_rates[87]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[174];
+#else
   kf = exp(2.1416413017506358e+01 - (2.1487475419486250e+02 / T));
+#endif
   kr = kf / Kc;
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1536,6 +1600,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 88 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[137];
+#else
   if (T <= 1000.0) {
     Kc = (-6.9580548999999969e-01 + 2.3231045000000039e-01 * logT + T * (-1.9207073365000000e-03 + T * (1.0545304499999991e-06 + T * (-3.5884544916666708e-10 + 5.3778554000000095e-14 * T))) - -1.5911417119999998e+04 / T);
   } else {
@@ -1543,8 +1610,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[88] - 2.0 * rev_rates[88]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[175];
+#else
   kf = exp(3.5069404645972853e+01 - (1.4799687402507976e+04 / T));
+#endif
   kr = kf / Kc;
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1763,6 +1835,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 89 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[138];
+#else
   if (T <= 1000.0) {
     Kc = (-8.9893508499999975e-01 + -4.6672151000000017e-01 * logT + T * (1.0562507823526665e-03 + T * (-7.2248605449931987e-07 + T * (4.6003117544173469e-10 + -1.2675303229638663e-13 * T))) - -7.7929389859999996e+04 / T);
   } else {
@@ -1770,6 +1845,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[89] - 2.0 * rev_rates[89]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -1990,6 +2066,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 90 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[139];
+#else
   if (T <= 1000.0) {
     Kc = (1.7282501949999998e+00 + -7.6064623999999936e-01 * logT + T * (-5.8322167014733365e-04 + T * (1.8084994730006798e-06 + T * (-1.0496207698082652e-09 + 2.1898323095361339e-13 * T))) - -4.5099149099999995e+04 / T);
   } else {
@@ -1997,6 +2076,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[90] - 2.0 * rev_rates[90]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2217,6 +2297,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 91 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[140];
+#else
   if (T <= 1000.0) {
     Kc = (-8.4150539499999955e-01 + -4.6097095000000010e-01 * logT + T * (-4.2379441561473333e-03 + T * (4.9848606630006798e-06 + T * (-2.5163734364749319e-09 + 5.0628666545361342e-13 * T))) - -3.8454417459999997e+04 / T);
   } else {
@@ -2224,6 +2307,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[91] - 2.0 * rev_rates[91]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -2444,6 +2528,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 92 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[141];
+#else
   if (T <= 1000.0) {
     Kc = (-1.5739063000000009e-01 + -6.6236889999999882e-02 * logT + T * (-1.4007659100000007e-04 + T * (-4.3023756000000001e-07 + T * (4.5052062583333339e-10 + -1.3428221950000000e-13 * T))) - -9.1155539600000011e+03 / T);
   } else {
@@ -2451,8 +2538,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[92] - 2.0 * rev_rates[92]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[176];
+#else
   kf = exp(9.3325580047004326e+00 + 2.0 * logT - (1.5096586945774882e+03 / T));
+#endif
   kr = kf / Kc;
   jac[63] +=  6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2671,6 +2763,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 93 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[142];
+#else
   if (T <= 1000.0) {
     Kc = (1.9260708619999996e+00 + -8.9689639000000021e-01 * logT + T * (-2.5702009896473336e-03 + T * (4.0785166980006795e-06 + T * (-2.2799360798082651e-09 + 4.9350015645361341e-13 * T))) - -4.2947193659999997e+04 / T);
   } else {
@@ -2678,6 +2773,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[93] - 2.0 * rev_rates[93]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2903,6 +2999,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 94 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[143];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0545270920000003e+00 + -9.5021000999999972e-01 * logT + T * (-7.4202735650000006e-03 + T * (9.1493264216666673e-06 + T * (-5.0273651100000005e-09 + 1.1113648879999998e-12 * T))) - -4.5702844960000002e+04 / T);
   } else {
@@ -2910,10 +3009,15 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[94] - rev_rates[94]);
   j_temp = -mw_avg * rho_inv * pres_mod[20] * (2.0 * fwd_rates[94] - rev_rates[94] + pres_mod_temp);
   pres_mod_temp *= exp(3.4899029160197301e+01 - 4.49 * logT - (9.1082741239508448e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[177];
+#else
   kf = exp(3.5564817990743961e+01 - 1.43 * logT - (6.6928202126268650e+02 / T));
+#endif
   kr = kf / Kc;
   jac[74] +=  1.5894874694922317e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -3080,6 +3184,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 95 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[144];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0828526300000001e+00 + 2.9571340000000079e-01 * logT + T * (-3.3859809350000002e-04 + T * (-1.7214274166666665e-07 + T * (1.1778545249999987e-10 + -2.2428833999999994e-14 * T))) - -4.3497659600000025e+03 / T);
   } else {
@@ -3087,8 +3194,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[95] - 2.0 * rev_rates[95]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[178];
+#else
   kf = exp(1.0933106969717286e+01 + 1.6 * logT - (2.7274500415366620e+03 / T));
+#endif
   kr = kf / Kc;
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3307,6 +3419,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 96 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[145];
+#else
   if (T <= 1000.0) {
     Kc = (-3.8504288870000001e+00 + 7.3163884000000001e-01 * logT + T * (-2.0063412599999999e-03 + T * (7.3420122333333307e-07 + T * (-1.1865190416666682e-10 + -9.6423250000000015e-15 * T))) - 1.4301023999999961e+02 / T);
   } else {
@@ -3314,8 +3429,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[96] - 2.0 * rev_rates[96]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[179];
+#else
   kf = exp(3.4098719842032899e+01 - 1.34 * logT - (7.1306212340543357e+02 / T));
+#endif
   kr = kf / Kc;
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[65] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3534,6 +3654,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[14] += -j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 97 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[146];
+#else
   if (T <= 1000.0) {
     Kc = (6.7704219399999994e+00 + -1.2696605999999995e+00 * logT + T * (8.0234069850000003e-03 + T * (-6.9245629400000004e-06 + T * (3.3330242550000006e-09 + -6.8588373949999998e-13 * T))) - -7.2171608599999963e+03 / T);
   } else {
@@ -3541,8 +3664,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[97] - 2.0 * rev_rates[97]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[180];
+#else
   kf = exp(1.1512925464970229e+01 + 1.6 * logT - (1.5700450423605878e+03 / T));
+#endif
   kr = kf / Kc;
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3761,6 +3889,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 98 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[147];
+#else
   if (T <= 1000.0) {
     Kc = (8.7646609250000012e+00 + -2.7147753799999998e+00 * logT + T * (5.9981339853526668e-03 + T * (-2.1263859053326532e-06 + T * (4.5277647235840132e-10 + -3.0169487496386613e-14 * T))) - -1.2169304360000002e+04 / T);
   } else {
@@ -3768,8 +3899,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[98] - 2.0 * rev_rates[98]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[181];
+#else
   kf = exp(1.0770588040219511e+01 + 1.228 * logT - (3.5225369540141394e+01 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3988,6 +4124,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 99 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[148];
+#else
   if (T <= 1000.0) {
     Kc = (-1.9604265999999893e-01 + -4.3502724000000059e-01 * logT + T * (1.4992275299999999e-03 + T * (-1.8101110949999999e-06 + T * (1.0512148244999999e-09 + -2.4171248394999997e-13 * T))) - -5.2092458220000000e+04 / T);
   } else {
@@ -3995,6 +4134,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[99] - 2.0 * rev_rates[99]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -4215,6 +4355,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 100 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[149];
+#else
   if (T <= 1000.0) {
     Kc = (2.4123649599999997e+00 + -3.6591217999999914e-01 * logT + T * (3.5146458949999997e-03 + T * (-3.6065987499999994e-06 + T * (1.9172732924999999e-09 + -4.2158565400000006e-13 * T))) - -1.5760285599999997e+04 / T);
   } else {
@@ -4222,8 +4365,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[100] - 2.0 * rev_rates[100]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[182];
+#else
   kf = exp(1.5048070819142122e+01 + 1.18 * logT - (-2.2493914549204575e+02 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  -1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4442,6 +4590,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 101 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[150];
+#else
   if (T <= 1000.0) {
     Kc = (-6.7517753799999998e+00 + 1.1364591000000002e+00 * logT + T * (-7.5700866550000006e-03 + T * (5.5486244316666665e-06 + T * (-2.4235135158333333e-09 + 4.6077279450000004e-13 * T))) - -4.5023850290000002e+04 / T);
   } else {
@@ -4449,6 +4600,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[101] - 2.0 * rev_rates[101]);
   kf = 5000000000.0;
   kr = kf / Kc;
@@ -4669,6 +4821,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 102 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[151];
+#else
   if (T <= 1000.0) {
     Kc = (-1.6188615130000002e+01 + 2.8941442800000003e+00 * logT + T * (-8.3800226349999996e-03 + T * (5.6476654166666667e-06 + T * (-2.6798106158333328e-09 + 5.7547593350000009e-13 * T))) - -4.9196365059999996e+04 / T);
   } else {
@@ -4676,6 +4831,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[102] - 2.0 * rev_rates[102]);
   kf = 5000000000.0;
   kr = kf / Kc;
@@ -4896,6 +5052,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 103 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[152];
+#else
   if (T <= 1000.0) {
     Kc = (7.8768954200000012e+00 + -1.6448815099999998e+00 * logT + T * (1.0596259680000001e-02 + T * (-9.5681556483333339e-06 + T * (4.9183875341666663e-09 + -1.0678866774999998e-12 * T))) - -1.1459955330000004e+04 / T);
   } else {
@@ -4903,8 +5062,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[103] - 2.0 * rev_rates[103]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[183];
+#else
   kf = exp(7.2723983925700466e+00 + 2.0 * logT - (-4.2270443448169669e+02 / T));
+#endif
   kr = kf / Kc;
   jac[72] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5123,6 +5287,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 104 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[153];
+#else
   if (T <= 1000.0) {
     Kc = (1.7313735170000001e+01 + -3.4025666900000000e+00 * logT + T * (1.1406195660000000e-02 + T * (-9.6671966333333349e-06 + T * (5.1746846341666666e-09 + -1.1825898164999999e-12 * T))) - -7.2874405600000027e+03 / T);
   } else {
@@ -5130,8 +5297,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[104] - 2.0 * rev_rates[104]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[184];
+#else
   kf = exp(8.7483049123796235e+00 + 2.0 * logT - (7.5482934728874409e+02 / T));
+#endif
   kr = kf / Kc;
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[73] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5350,6 +5522,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[22] += -j_temp * 2.5029940000000000e+01;
 
   //partial of rxn 105 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[154];
+#else
   if (T <= 1000.0) {
     Kc = (8.0546465849999986e+00 + -2.1299513599999997e+00 * logT + T * (3.3231887103526668e-03 + T * (2.1651781334013507e-08 + T * (-6.9351768064159861e-10 + 2.2512776495361328e-13 * T))) - -2.4921364860000009e+04 / T);
   } else {
@@ -5357,6 +5532,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[105] - 2.0 * rev_rates[105]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -5577,6 +5753,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[23] += -j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 106 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[155];
+#else
   if (T <= 1000.0) {
     Kc = (-1.9019542709999975e+00 + -1.6486022400000011e-01 * logT + T * (-1.4206866396473342e-03 + T * (2.2507492813340137e-06 + T * (-1.2325112239749320e-09 + 2.5610194445361339e-13 * T))) - -1.1613319400000000e+04 / T);
   } else {
@@ -5584,8 +5763,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[106] - 2.0 * rev_rates[106]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[185];
+#else
   kf = exp(-1.5338770774157322e+01 + 4.5 * logT - (-5.0321956485916274e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5804,6 +5988,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[23] += -j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 107 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[156];
+#else
   if (T <= 1000.0) {
     Kc = (6.5017972900000132e-01 + -1.0583232240000000e+00 * logT + T * (5.0559778103526666e-03 + T * (-3.3279368186659867e-06 + T * (1.5835850526917346e-09 + -3.4389894804638668e-13 * T))) - 3.4612129400000013e+03 / T);
   } else {
@@ -5811,8 +5998,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[107] - 2.0 * rev_rates[107]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[186];
+#else
   kf = exp(6.2225762680713688e+00 + 2.3 * logT - (6.7934641255986971e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6031,6 +6223,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[23] += -j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 108 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[157];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0749448835999999e+01 + 2.2876013660000005e+00 * logT + T * (-4.7933591900000006e-03 + T * (1.4904491833333333e-06 + T * (-1.1914707499999943e-11 + -1.0122789449999994e-13 * T))) - 6.5016052400000044e+03 / T);
   } else {
@@ -6038,8 +6233,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[108] - 2.0 * rev_rates[108]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[187];
+#else
   kf = exp(1.0425253116340453e+01 + 2.0 * logT - (7.0450739080282783e+03 / T));
+#endif
   kr = kf / Kc;
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6258,6 +6458,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 109 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[158];
+#else
   if (T <= 1000.0) {
     Kc = (-1.1175233377999998e+01 + 2.4524273460000003e+00 * logT + T * (-9.7798236550000021e-03 + T * (6.2743793299999998e-06 + T * (-2.5081898946666667e-09 + 4.3880239404999997e-13 * T))) - -2.7943148459999997e+04 / T);
   } else {
@@ -6265,8 +6468,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[109] - 2.0 * rev_rates[109]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[188];
+#else
   kf = exp(-1.4543249183293838e+01 + 4.0 * logT - (-1.0064391297183255e+03 / T));
+#endif
   kr = kf / Kc;
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6485,6 +6693,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 110 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[159];
+#else
   if (T <= 1000.0) {
     Kc = (6.8812183259999999e+00 + -2.1971602259999994e+00 * logT + T * (1.1105827350000000e-02 + T * (-9.9226098333333329e-06 + T * (5.1811825925000002e-09 + -1.1403976785000000e-12 * T))) - -4.2339673360000001e+04 / T);
   } else {
@@ -6492,6 +6703,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[110] - 2.0 * rev_rates[110]);
   kf = 5000000000.0;
   kr = kf / Kc;
@@ -6712,6 +6924,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 111 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[160];
+#else
   if (T <= 1000.0) {
     Kc = (4.2082124400000005e+00 + -5.4010989999999914e-01 * logT + T * (4.7250987550000005e-03 + T * (-4.8792707166666667e-06 + T * (2.6488544424999991e-09 + -5.9327432650000018e-13 * T))) - -4.1387363899999982e+03 / T);
   } else {
@@ -6719,8 +6934,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[111] - 2.0 * rev_rates[111]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[189];
+#else
   kf = exp(8.1886891244442008e+00 + 2.0 * logT - (1.2580489121479068e+03 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6939,6 +7159,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 112 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[161];
+#else
   if (T <= 1000.0) {
     Kc = (1.0736134400000008e+00 + 2.2166589000000014e-01 * logT + T * (8.3991859999999960e-04 + T * (-1.3878474000000007e-06 + T * (7.7726088416666741e-10 + -1.7049066149999997e-13 * T))) - -9.5449752599999956e+03 / T);
   } else {
@@ -6946,8 +7169,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[112] - 2.0 * rev_rates[112]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[190];
+#else
   kf = exp(8.1718820061278201e+00 + 2.12 * logT - (4.3780102142747160e+02 / T));
+#endif
   kr = kf / Kc;
   jac[79] +=  1.4416383911740777e+01 * (j_temp * 9.2803892982949643e-01);
   jac[80] +=  -1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7166,6 +7394,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[29] += -j_temp * 4.2037279999999996e+01;
 
   //partial of rxn 113 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[162];
+#else
   if (T <= 1000.0) {
     Kc = (-7.9284798000000123e-01 + 3.2251023000000067e-01 * logT + T * (-4.9483839999999585e-05 + T * (-7.3864831666666654e-07 + T * (5.2707883583333358e-10 + -1.3220207400000005e-13 * T))) - -6.8064402199999995e+03 / T);
   } else {
@@ -7173,8 +7404,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[113] - 2.0 * rev_rates[113]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[191];
+#else
   kf = exp(2.2738168857488677e+01 - (1.0064391297183255e+03 / T));
+#endif
   kr = kf / Kc;
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[81] +=  2.0353066650792705e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7392,6 +7628,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[8] += j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 114 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[163];
+#else
   if (T <= 1000.0) {
     Kc = (2.0442853999999988e-01 + -5.4502696999999989e-01 * logT + T * (2.9793422214999996e-03 + T * (-2.6226176816666659e-06 + T * (1.4412002008333338e-09 + -3.3581152400000011e-13 * T))) - -1.9356141739999999e+04 / T);
   } else {
@@ -7399,8 +7638,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[114] - 2.0 * rev_rates[114]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[192];
+#else
   kf = exp(1.8683045008419857e+01 - (-8.2024789072043529e+02 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[60] +=  -3.2746730956207706e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7566,6 +7810,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[8] += j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 115 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[163];
+#else
   if (T <= 1000.0) {
     Kc = (2.0442853999999988e-01 + -5.4502696999999989e-01 * logT + T * (2.9793422214999996e-03 + T * (-2.6226176816666659e-06 + T * (1.4412002008333338e-09 + -3.3581152400000011e-13 * T))) - -1.9356141739999999e+04 / T);
   } else {
@@ -7573,8 +7820,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[115] - 2.0 * rev_rates[115]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[193];
+#else
   kf = exp(2.6763520548223823e+01 - (6.0386347783099527e+03 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[60] +=  -3.2746730956207706e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7741,6 +7993,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 116 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[164];
+#else
   if (T <= 1000.0) {
     Kc = (-5.5015687580000012e+00 + 7.2126190000000001e-01 * logT + T * (-4.2647014214999999e-03 + T * (2.9977919499999997e-06 + T * (-1.1401965416666665e-09 + 1.7808557350000002e-13 * T))) - -5.6992724280000002e+04 / T);
   } else {
@@ -7748,6 +8003,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[116] - 2.0 * rev_rates[116]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -7968,6 +8224,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 117 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[165];
+#else
   if (T <= 1000.0) {
     Kc = (-7.2617988899999997e+00 + 9.5694408000000042e-01 * logT + T * (-6.9647721000000006e-03 + T * (5.3564757083333336e-06 + T * (-2.2506695033333334e-09 + 4.0385076949999996e-13 * T))) - -2.8050398000000001e+04 / T);
   } else {
@@ -7975,6 +8234,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[117] - 2.0 * rev_rates[117]);
   kf = 1000000000.0;
   kr = kf / Kc;
@@ -8195,6 +8455,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 118 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[166];
+#else
   if (T <= 1000.0) {
     Kc = (9.6041937419999979e+00 + -1.8771689800000000e+00 * logT + T * (3.7767231199999996e-03 + T * (-2.8220162083333331e-06 + T * (1.6573995266666667e-09 + -4.1981919400000005e-13 * T))) - -1.2146125180000001e+04 / T);
   } else {
@@ -8202,6 +8465,7 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[118] - 2.0 * rev_rates[118]);
   kf = 37800000000.0;
   kr = kf / Kc;
@@ -8422,6 +8686,9 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   jac[15] += -j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 119 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[167];
+#else
   if (T <= 1000.0) {
     Kc = (4.1045975619999995e+00 + -1.5325425300000002e+00 * logT + T * (5.9713767200000002e-03 + T * (-4.1134546183333329e-06 + T * (1.8289533671666668e-09 + -3.5837057945000006e-13 * T))) - -3.0707611180000004e+04 / T);
   } else {
@@ -8429,8 +8696,13 @@ void eval_jacob_2 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[119] - 2.0 * rev_rates[119]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[194];
+#else
   kf = exp(2.5733901131042668e+01 - (1.1875981730676242e+04 / T));
+#endif
   kr = kf / Kc;
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[69] +=  2.1831557433974243e+01 * (j_temp * 9.2803892982949643e-01);
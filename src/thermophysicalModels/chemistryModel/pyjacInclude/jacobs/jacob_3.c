@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_3 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -23,6 +27,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[8] += j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 120 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[195];
+#else
   if (T <= 1000.0) {
     Kc = (3.1081704499999998e+00 + -5.9822262999999953e-01 * logT + T * (5.4353532314999993e-03 + T * (-4.6611291999999993e-06 + T * (2.2761187416666672e-09 + -4.7536420800000006e-13 * T))) - 1.5113152000000264e+02 / T);
   } else {
@@ -30,8 +37,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[120] - 2.0 * rev_rates[120]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[230];
+#else
   kf = exp(8.6305218767232414e+00 + 2.0 * logT - (6.0386347783099527e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  -1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -250,6 +262,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 121 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[196];
+#else
   if (T <= 1000.0) {
     Kc = (-3.0397461299999997e+00 + 4.1110465999999990e-01 * logT + T * (-2.8570031800000009e-04 + T * (-4.8686932750000001e-07 + T * (4.3270580191666671e-10 + -1.1510073024999998e-13 * T))) - -6.9601766439999992e+04 / T);
   } else {
@@ -257,8 +272,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[121] - 2.0 * rev_rates[121]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[231];
+#else
   kf = exp(2.4783708847492832e+01 - (2.8985446935887774e+02 / T));
+#endif
   kr = kf / Kc;
   jac[62] +=  -5.9581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -477,6 +497,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[22] += j_temp * 2.5029940000000000e+01;
 
   //partial of rxn 122 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[197];
+#else
   if (T <= 1000.0) {
     Kc = (6.0970208699999962e-01 + -9.2726089000000034e-01 * logT + T * (6.3813133408526660e-03 + T * (-5.3342734594993203e-06 + T * (2.8385209101084016e-09 + -6.4435448684638660e-13 * T))) - -3.9134870199999990e+04 / T);
   } else {
@@ -484,6 +507,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[122] - 2.0 * rev_rates[122]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -704,6 +728,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 123 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[198];
+#else
   if (T <= 1000.0) {
     Kc = (1.0276298292999998e+01 + -2.9191488560000005e+00 * logT + T * (1.0836074437352667e-02 + T * (-6.9968653844993205e-06 + T * (2.9682210701084015e-09 + -5.6555542634638654e-13 * T))) - -4.9986241399999999e+04 / T);
   } else {
@@ -711,6 +738,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[123] - 2.0 * rev_rates[123]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -931,6 +959,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[4] += -j_temp * 3.1998799999999999e+01;
 
   //partial of rxn 124 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[199];
+#else
   if (T <= 1000.0) {
     Kc = (-4.1256085000000020e-01 + 1.1717993000000071e-01 * logT + T * (-1.9251727705000001e-03 + T * (2.0441161999999999e-06 + T * (-1.0769461433333334e-09 + 2.3063553300000001e-13 * T))) - -3.6771525679999992e+04 / T);
   } else {
@@ -938,6 +969,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[124] - 2.0 * rev_rates[124]);
   kf = 67100000000.0;
   kr = kf / Kc;
@@ -1158,6 +1190,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 125 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[200];
+#else
   if (T <= 1000.0) {
     Kc = (-2.0797032209999999e+00 + 4.2853090000000016e-01 * logT + T * (-3.6677420736473333e-03 + T * (3.9936733430006793e-06 + T * (-2.2641911831415986e-09 + 5.2348127345361335e-13 * T))) - 1.5983417730000074e+03 / T);
   } else {
@@ -1165,8 +1200,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[125] - 2.0 * rev_rates[125]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[232];
+#else
   kf = exp(2.5405397064070630e+01 - (1.5650128467119962e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[9]);
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01 + kf * conc[9]);
@@ -1385,6 +1425,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 126 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[201];
+#else
   if (T <= 1000.0) {
     Kc = (-6.8411476499999990e-01 + -3.9473406000000022e-01 * logT + T * (-4.0978675651473333e-03 + T * (5.4150982230006794e-06 + T * (-2.9668940623082650e-09 + 6.4056888495361337e-13 * T))) - -2.9338863499999999e+04 / T);
   } else {
@@ -1392,8 +1435,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[126] - 2.0 * rev_rates[126]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[233];
+#else
   kf = exp(2.2465484860614328e+01 - (-3.7993077146866790e+02 / T));
+#endif
   kr = kf / Kc;
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  -8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1612,6 +1660,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 127 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[202];
+#else
   if (T <= 1000.0) {
     Kc = (1.3790293542999999e+01 + -3.9438142259999998e+00 * logT + T * (1.1034427608352666e-02 + T * (-6.1038482103326536e-06 + T * (2.3919984968584015e-09 + -4.3910281304638660e-13 * T))) - -6.4898692899999995e+04 / T);
   } else {
@@ -1619,6 +1670,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[127] - 2.0 * rev_rates[127]);
   kf = 40000000000.0;
   kr = kf / Kc;
@@ -1839,6 +1891,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 128 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[203];
+#else
   if (T <= 1000.0) {
     Kc = (5.8262225870000002e+00 + -1.4509406000000000e+00 * logT + T * (-4.0999783514733361e-04 + T * (3.6466188813340132e-06 + T * (-2.6713986431415987e-09 + 6.7886603145361340e-13 * T))) - -2.6908785499999998e+04 / T);
   } else {
@@ -1846,6 +1901,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[128] - 2.0 * rev_rates[128]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -2066,6 +2122,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 129 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[204];
+#else
   if (T <= 1000.0) {
     Kc = (8.3884320869999982e+00 + -2.1804912999999999e+00 * logT + T * (2.8883103948526665e-03 + T * (1.6013266580006797e-06 + T * (-1.9872288306415980e-09 + 5.8625661845361341e-13 * T))) - -2.9987209969999996e+04 / T);
   } else {
@@ -2073,6 +2132,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[129] - 2.0 * rev_rates[129]);
   kf = 60000000000.0;
   kr = kf / Kc;
@@ -2298,6 +2358,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += -j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 130 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[205];
+#else
   if (T <= 1000.0) {
     Kc = (1.1715625360000001e+01 + -3.8176287199999996e+00 * logT + T * (8.9707695694999992e-03 + T * (-3.8428207800000003e-06 + T * (1.1005483205000003e-09 + -1.3779829655000002e-13 * T))) - -3.6393758399999992e+04 / T);
   } else {
@@ -2305,6 +2368,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[130] - rev_rates[130]);
   j_temp = -mw_avg * rho_inv * pres_mod[21] * (2.0 * fwd_rates[130] - rev_rates[130] + pres_mod_temp);
   pres_mod_temp *= exp(2.7011124397108194e+01 - 3.74 * logT - (9.7423307756733914e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
@@ -2475,6 +2539,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[16] += -j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 131 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[206];
+#else
   if (T <= 1000.0) {
     Kc = (-7.0364107300000001e+00 + 1.9541291400000005e+00 * logT + T * (-6.5813556555000003e-03 + T * (3.9348853783333332e-06 + T * (-1.5023972421666667e-09 + 2.4915271845000002e-13 * T))) - -3.2929844739999986e+04 / T);
   } else {
@@ -2482,8 +2549,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[131] - 2.0 * rev_rates[131]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[234];
+#else
   kf = exp(2.5970289909106896e+01 - (7.9468433682558980e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2702,6 +2774,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 132 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[207];
+#else
   if (T <= 1000.0) {
     Kc = (1.2729844667000000e+01 + -3.6477035000000004e+00 * logT + T * (1.3851685124852665e-02 + T * (-8.8379595919993197e-06 + T * (3.6758607093584009e-09 + -6.8928753404638662e-13 * T))) - -3.8057594839999998e+04 / T);
   } else {
@@ -2709,8 +2784,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[132] - 2.0 * rev_rates[132]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[235];
+#else
   kf = exp(2.5272923313004245e+01 - (-2.5915807590246879e+02 / T));
+#endif
   kr = kf / Kc;
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[82] +=  2.0853066650792702e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2929,6 +3009,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 133 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[208];
+#else
   if (T <= 1000.0) {
     Kc = (4.2270097859999982e+00 + -1.3533234860000001e+00 * logT + T * (2.3861763395000013e-03 + T * (-1.5137125866666667e-06 + T * (7.0702644283333312e-10 + -1.4662912344999990e-13 * T))) - -7.8771847699999984e+04 / T);
   } else {
@@ -2936,6 +3019,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[133] - 2.0 * rev_rates[133]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -3158,7 +3242,11 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 134 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[134]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[236];
+#else
   kf = exp(2.2332703749380510e+01 - (7.5482934728874409e+02 / T));
+#endif
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3428,6 +3516,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 135 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[209];
+#else
   if (T <= 1000.0) {
     Kc = (-1.1542412209999999e+00 + 6.6580609999999929e-02 * logT + T * (-3.4692205711473328e-03 + T * (3.7355785246673466e-06 + T * (-1.9314560098082654e-09 + 4.1162788795361337e-13 * T))) - -3.1674462269999967e+03 / T);
   } else {
@@ -3435,8 +3526,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[135] - 2.0 * rev_rates[134]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[237];
+#else
   kf = exp(6.2146080984221914e+00 + 2.0 * logT - (3.6382774539317465e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[10]);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + kf * conc[10]);
@@ -3654,6 +3750,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 136 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[210];
+#else
   if (T <= 1000.0) {
     Kc = (1.5869996764000000e+01 + -4.3723451259999999e+00 * logT + T * (1.4702169681999999e-02 + T * (-1.0097521553333333e-05 + T * (4.6561896800000000e-09 + -9.6258408650000009e-13 * T))) - -6.6497034673000002e+04 / T);
   } else {
@@ -3661,8 +3760,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[136] - 2.0 * rev_rates[135]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[238];
+#else
   kf = exp(2.8101024745174282e+01 - (6.0104544826778401e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[22]);
   jac[64] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 - kr * conc[22]);
@@ -3829,6 +3933,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 137 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[211];
+#else
   if (T <= 1000.0) {
     Kc = (1.4606195170000000e+00 + -9.7706759000000032e-01 * logT + T * (-5.2751731811473343e-03 + T * (8.0956520380006795e-06 + T * (-4.8697324598082650e-09 + 1.1378581384536135e-12 * T))) - -3.1885603070000001e+04 / T);
   } else {
@@ -3836,6 +3943,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[137] - 2.0 * rev_rates[136]);
   kf = 40000000000.0;
   kr = kf / Kc;
@@ -4055,6 +4163,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[14] += -j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 138 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[212];
+#else
   if (T <= 1000.0) {
     Kc = (7.8532745699999982e+00 + -1.5653739999999998e+00 * logT + T * (8.3620050785000004e-03 + T * (-6.7524201983333334e-06 + T * (3.2152388025000006e-09 + -6.6345490549999999e-13 * T))) - -2.8673948999999957e+03 / T);
   } else {
@@ -4062,8 +4173,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[138] - 2.0 * rev_rates[137]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[239];
+#else
   kf = exp(7.8079166289264084e+00 + 2.0 * logT - (4.1616258013852757e+03 / T));
+#endif
   kr = kf / Kc;
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4234,6 +4350,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += -j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 139 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[213];
+#else
   if (T <= 1000.0) {
     Kc = (1.2351082710000000e+01 + -4.2063758399999998e+00 * logT + T * (8.8801768185000005e-03 + T * (-3.5344100233333329e-06 + T * (1.0239901105000000e-09 + -1.3987844205000002e-13 * T))) - -3.8702872139999992e+04 / T);
   } else {
@@ -4241,10 +4360,15 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[139] - rev_rates[138]);
   j_temp = -mw_avg * rho_inv * pres_mod[22] * (2.0 * fwd_rates[139] - rev_rates[138] + pres_mod_temp);
   pres_mod_temp *= exp(4.2646793898822224e+01 - 5.61 * logT - (1.3008225751609357e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[240];
+#else
   kf = exp(2.0512544805630757e+01 + 0.5 * logT - (2.2695202375148242e+03 / T));
+#endif
   kr = kf / Kc;
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[82] +=  2.0853066650792702e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -4411,6 +4535,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 140 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[214];
+#else
   if (T <= 1000.0) {
     Kc = (-2.8115991699999983e+00 + 7.7759984999999920e-01 * logT + T * (-8.8597276014999986e-03 + T * (7.9786596866666658e-06 + T * (-4.0236355238333331e-09 + 8.5948633554999997e-13 * T))) - -4.5547728300000002e+04 / T);
   } else {
@@ -4418,6 +4545,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[140] - 2.0 * rev_rates[139]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -4636,6 +4764,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 141 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[215];
+#else
   if (T <= 1000.0) {
     Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
   } else {
@@ -4643,8 +4774,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[141] - 2.0 * rev_rates[140]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[241];
+#else
   kf = exp(2.3431316038048621e+01 - (3.0193173891549765e+02 / T));
+#endif
   kr = kf / Kc;
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[11] - kr * conc[10]));
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[11] - kr * conc[10]));
@@ -4757,6 +4893,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 142 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[215];
+#else
   if (T <= 1000.0) {
     Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
   } else {
@@ -4764,8 +4903,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[142] - 2.0 * rev_rates[141]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[242];
+#else
   kf = exp(2.2920490414282632e+01 - (3.0193173891549765e+02 / T));
+#endif
   kr = kf / Kc;
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4881,6 +5025,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 143 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[216];
+#else
   if (T <= 1000.0) {
     Kc = (-2.0212442240000001e+00 + 1.0904884300000002e+00 * logT + T * (1.1758385753526663e-03 + T * (-2.0742519119993201e-06 + T * (1.1162772880250682e-09 + -2.3635927699638663e-13 * T))) - -3.4688218280000001e+04 / T);
   } else {
@@ -4888,6 +5035,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[143] - 3.0 * rev_rates[142]);
   kf = 28000000000.0;
   kr = kf / Kc;
@@ -5160,6 +5308,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 144 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[217];
+#else
   if (T <= 1000.0) {
     Kc = (-2.6293251000000240e-02 + -2.0288643999999900e-01 * logT + T * (1.3582802849999998e-03 + T * (-1.7571746283333335e-06 + T * (9.8237418033333331e-10 + -2.1596610345000000e-13 * T))) - -9.4070685439999987e+04 / T);
   } else {
@@ -5167,6 +5318,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[144] - 2.0 * rev_rates[143]);
   kf = 12000000000.0;
   kr = kf / Kc;
@@ -5387,6 +5539,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 145 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[218];
+#else
   if (T <= 1000.0) {
     Kc = (1.6133350359999996e+00 + -3.6934482999999974e-01 * logT + T * (-1.8014774046473331e-03 + T * (2.8292345596673468e-06 + T * (-1.6950186531415987e-09 + 3.9884137895361337e-13 * T))) - -7.6602224269999970e+03 / T);
   } else {
@@ -5394,6 +5549,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[145] - 2.0 * rev_rates[144]);
   kf = 70000000000.0;
   kr = kf / Kc;
@@ -5619,6 +5775,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[6] += -j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 146 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[219];
+#else
   if (T <= 1000.0) {
     Kc = (2.7959017949999989e+00 + -1.6818488499999997e+00 * logT + T * (-5.4139323050000007e-03 + T * (8.4151251983333340e-06 + T * (-4.9087132058333330e-09 + 1.1210072129999999e-12 * T))) - -4.5845855199999991e+04 / T);
   } else {
@@ -5626,10 +5785,15 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[146] - rev_rates[145]);
   j_temp = -mw_avg * rho_inv * pres_mod[23] * (2.0 * fwd_rates[146] - rev_rates[145] + pres_mod_temp);
   pres_mod_temp *= exp(4.0505029522672174e+01 - 5.2 * logT - (1.9600402051264391e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[243];
+#else
   kf = exp(3.3808965229979151e+01 - 1.16 * logT - (5.7618640176374140e+02 / T));
+#endif
   kr = kf / Kc;
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[74] +=  1.5894874694922317e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -5794,6 +5958,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 147 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[215];
+#else
   if (T <= 1000.0) {
     Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
   } else {
@@ -5801,6 +5968,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[147] - 2.0 * rev_rates[146]);
   kf = 30000000000.0;
   kr = kf / Kc;
@@ -5917,6 +6085,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 148 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[220];
+#else
   if (T <= 1000.0) {
     Kc = (4.2281957739999996e+00 + -1.4129930300000000e+00 * logT + T * (-3.6074300146473337e-03 + T * (7.1893080730006792e-06 + T * (-4.6332951031415987e-09 + 1.1250716294536134e-12 * T))) - -3.6378379270000005e+04 / T);
   } else {
@@ -5924,8 +6095,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[148] - 2.0 * rev_rates[147]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[244];
+#else
   kf = exp(2.3208172486734412e+01 - (-2.8683515196972274e+02 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -6143,6 +6319,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[14] += -j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 149 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[221];
+#else
   if (T <= 1000.0) {
     Kc = (1.0620850826999998e+01 + -2.0012994399999995e+00 * logT + T * (1.0029748245000001e-02 + T * (-7.6587641633333328e-06 + T * (3.4516761591666673e-09 + -6.7624141450000000e-13 * T))) - -7.3601710999999959e+03 / T);
   } else {
@@ -6150,8 +6329,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[149] - 2.0 * rev_rates[148]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[245];
+#else
   kf = exp(2.3495854559186192e+01 - (-2.8683515196972274e+02 / T));
+#endif
   kr = kf / Kc;
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6316,6 +6500,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 150 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[215];
+#else
   if (T <= 1000.0) {
     Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
   } else {
@@ -6323,6 +6510,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[150] - 2.0 * rev_rates[149]);
   kf = 9000000000.0;
   kr = kf / Kc;
@@ -6437,6 +6625,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[12] += -j_temp * 1.4026879999999998e+01;
 
   //partial of rxn 151 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[215];
+#else
   if (T <= 1000.0) {
     Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
   } else {
@@ -6444,6 +6635,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[151] - 2.0 * rev_rates[150]);
   kf = 7000000000.0;
   kr = kf / Kc;
@@ -6560,6 +6752,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[16] += -j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 152 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[222];
+#else
   if (T <= 1000.0) {
     Kc = (-6.8385900630000007e+00 + 1.8178789900000001e+00 * logT + T * (-8.5683349750000012e-03 + T * (6.2049026033333328e-06 + T * (-2.7327125521666666e-09 + 5.2366964395000012e-13 * T))) - -3.0777889299999995e+04 / T);
   } else {
@@ -6567,6 +6762,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[152] - 2.0 * rev_rates[151]);
   kf = 14000000000.0;
   kr = kf / Kc;
@@ -6787,6 +6983,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 153 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[223];
+#else
   if (T <= 1000.0) {
     Kc = (4.9240423270000004e+00 + -5.0997294999999987e-01 * logT + T * (2.8462598599999995e-03 + T * (-2.1220486233333338e-06 + T * (8.9591278833333403e-10 + -1.6084833649999997e-13 * T))) - -9.6879854999999952e+03 / T);
   } else {
@@ -6794,8 +6993,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[153] - 2.0 * rev_rates[152]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[246];
+#else
   kf = exp(2.4412145291060348e+01 - (-2.7677076067253950e+02 / T));
+#endif
   kr = kf / Kc;
   jac[79] +=  1.4416383911740777e+01 * (j_temp * 9.2803892982949643e-01);
   jac[80] +=  -1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7014,6 +7218,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 154 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[224];
+#else
   if (T <= 1000.0) {
     Kc = (1.2123446059999999e+01 + -2.1815756600000000e+00 * logT + T * (2.4615292849999998e-03 + T * (-5.9933076833333345e-07 + T * (2.5389725833333334e-10 + -7.9965800000000011e-14 * T))) - 1.4719805059999999e+04 / T);
   } else {
@@ -7021,8 +7228,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[154] - 2.0 * rev_rates[153]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[247];
+#else
   kf = exp(2.4295611474804396e+01 - (1.5338132336907280e+04 / T));
+#endif
   kr = kf / Kc;
   jac[73] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7241,6 +7453,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 155 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[225];
+#else
   if (T <= 1000.0) {
     Kc = (-6.0930444379999997e+00 + 1.3296918199999999e+00 * logT + T * (-5.6619343999999997e-03 + T * (4.3937364400000000e-06 + T * (-2.1047658408333332e-09 + 4.3768970950000006e-13 * T))) - -2.6074931380000005e+04 / T);
   } else {
@@ -7248,8 +7463,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[155] - 2.0 * rev_rates[154]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[248];
+#else
   kf = exp(2.1560513361480112e+01 - (1.0222905460113891e+04 / T));
+#endif
   kr = kf / Kc;
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7468,6 +7688,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 156 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[226];
+#else
   if (T <= 1000.0) {
     Kc = (-7.4662274299999982e+00 + 1.5019710499999999e+00 * logT + T * (-9.9441143215000007e-03 + T * (7.9790933900000003e-06 + T * (-3.6918697041666675e-09 + 7.3966229350000022e-13 * T))) - -8.6942562600000019e+03 / T);
   } else {
@@ -7475,8 +7698,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[156] - 2.0 * rev_rates[155]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[249];
+#else
   kf = exp(3.1986731175506815e+00 + 2.47 * logT - (2.6066773459704632e+03 / T));
+#endif
   kr = kf / Kc;
   jac[66] +=  -7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
   jac[67] +=  7.9581919558703893e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7699,6 +7927,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * -2.0 * 1.5034820000000000e+01;
 
   //partial of rxn 157 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[227];
+#else
   if (T <= 1000.0) {
     Kc = (2.5134503800000001e+00 + -2.0557558800000004e+00 * logT + T * (-4.7617231000000003e-03 + T * (8.0805652800000013e-06 + T * (-4.7586900000000002e-09 + 1.0890431210000001e-12 * T))) - -4.4412203099999999e+04 / T);
   } else {
@@ -7706,10 +7937,15 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[157] - rev_rates[156]);
   j_temp = -mw_avg * rho_inv * pres_mod[24] * (2.0 * fwd_rates[157] - rev_rates[156] + pres_mod_temp);
   pres_mod_temp *= exp(4.9968146390566936e+01 - 5.8500000000000005 * logT - (1.0607868427231151e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[250];
+#else
   kf = exp(3.1846107295846778e+01 - 1.18 * logT - (3.2910559541789246e+02 / T));
+#endif
   kr = kf / Kc;
   jac[80] +=  1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[66] +=  -1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -7823,6 +8059,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[26] += j_temp * 2.9061699999999998e+01;
 
   //partial of rxn 158 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[228];
+#else
   if (T <= 1000.0) {
     Kc = (1.5921128470000006e+00 + -5.4071512000000066e-01 * logT + T * (-4.1042462096473340e-03 + T * (6.3756405963340138e-06 + T * (-3.8475260081415982e-09 + 8.9815928595361339e-13 * T))) - 5.4252887999999966e+03 / T);
   } else {
@@ -7830,8 +8069,13 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[158] - 2.0 * rev_rates[157]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[251];
+#else
   kf = exp(2.2646053568580871e+01 + 0.1 * logT - (5.3341273875071247e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  -1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7998,6 +8242,9 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 159 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[229];
+#else
   if (T <= 1000.0) {
     Kc = (-6.9664645999999983e+00 + 8.3463335999999932e-01 * logT + T * (-6.5241794550000001e-03 + T * (5.1144518450000005e-06 + T * (-2.2818094305000006e-09 + 4.4417125555000006e-13 * T))) - -4.4875297359999997e+04 / T);
   } else {
@@ -8005,6 +8252,7 @@ void eval_jacob_3 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[159] - 2.0 * rev_rates[158]);
   kf = 26480000000.0;
   kr = kf / Kc;
@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_4 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac, double * __restrict__ J_nplusone, double * __restrict__ J_nplusjplus) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -23,6 +27,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[14] += j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 160 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[252];
+#else
   if (T <= 1000.0) {
     Kc = (-4.3580569799999989e+00 + 9.0374842000000033e-01 * logT + T * (-4.5087610900000005e-03 + T * (3.3179641900000010e-06 + T * (-1.4157509625000007e-09 + 2.6429808549999996e-13 * T))) - -8.5431247399999993e+03 / T);
   } else {
@@ -30,8 +37,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[160] - 2.0 * rev_rates[159]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[291];
+#else
   kf = exp(1.1999647829283970e+00 + 2.81 * logT - (2.9488666500746936e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  -1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -250,6 +262,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 161 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[253];
+#else
   if (T <= 1000.0) {
     Kc = (1.1064734800000009e+00 + -3.7522091000000035e-01 * logT + T * (2.5728526950000007e-03 + T * (-2.6435927083333344e-06 + T * (1.5853632791666661e-09 + -3.8200293800000005e-13 * T))) - -4.2427944700000007e+03 / T);
   } else {
@@ -257,8 +272,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[161] - 2.0 * rev_rates[160]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[292];
+#else
   kf = exp(1.0308952660644293e+01 + 1.5 * logT - (5.0020024747000780e+03 / T));
+#endif
   kr = kf / Kc;
   jac[72] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[67] +=  7.9581919558703893e+00 * (j_temp * 9.2803892982949643e-01);
@@ -477,6 +497,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[21] += -j_temp * 3.2042160000000003e+01;
 
   //partial of rxn 162 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[254];
+#else
   if (T <= 1000.0) {
     Kc = (1.0543313230000003e+01 + -2.1329060900000005e+00 * logT + T * (3.3827886749999998e-03 + T * (-2.7426336933333337e-06 + T * (1.8416603791666656e-09 + -4.9670607699999980e-13 * T))) - -7.0279700000002777e+01 / T);
   } else {
@@ -484,8 +507,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[162] - 2.0 * rev_rates[161]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[293];
+#else
   kf = exp(9.2103403719761836e+00 + 1.5 * logT - (5.0020024747000780e+03 / T));
+#endif
   kr = kf / Kc;
   jac[67] +=  7.9581919558703893e+00 * (j_temp * 9.2803892982949643e-01);
   jac[73] +=  1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -704,6 +732,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[24] += j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 163 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[255];
+#else
   if (T <= 1000.0) {
     Kc = (-2.5622094999999989e+00 + 7.2955069999999989e-01 * logT + T * (-3.2983082300000002e-03 + T * (2.0452922233333329e-06 + T * (-6.8416981250000110e-10 + 9.2609412999999793e-14 * T))) - 3.0784244699999981e+03 / T);
   } else {
@@ -711,8 +742,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[163] - 2.0 * rev_rates[162]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[294];
+#else
   kf = exp(5.4249500174814029e+00 + 2.0 * logT - (4.6296199967042976e+03 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  -7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -931,6 +967,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[14] += j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 164 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[256];
+#else
   if (T <= 1000.0) {
     Kc = (-5.6968084999999977e+00 + 1.4913264899999996e+00 * logT + T * (-7.1834883850000007e-03 + T * (5.5367155399999999e-06 + T * (-2.5557633708333330e-09 + 5.1539307800000005e-13 * T))) - -2.3278143999999993e+03 / T);
   } else {
@@ -938,8 +977,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[164] - 2.0 * rev_rates[163]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[295];
+#else
   kf = exp(8.7225800211411890e+00 + 1.74 * logT - (5.2586444527782505e+03 / T));
+#endif
   kr = kf / Kc;
   jac[79] +=  1.4416383911740777e+01 * (j_temp * 9.2803892982949643e-01);
   jac[80] +=  -1.4916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -1157,6 +1201,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 165 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[257];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1909936329999997e+00 + 8.5834762999999947e-01 * logT + T * (1.3167858203526664e-03 + T * (-2.1271883786659866e-06 + T * (1.1851179321917346e-09 + -2.6210565749638660e-13 * T))) - 7.2900089399999997e+03 / T);
   } else {
@@ -1164,8 +1211,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[165] - 3.0 * rev_rates[164]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[296];
+#else
   kf = exp(3.4944241503018851e+01 - 1.0 * logT - (8.5547326026057672e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  -1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -1331,6 +1383,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 166 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[257];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1909936329999997e+00 + 8.5834762999999947e-01 * logT + T * (1.3167858203526664e-03 + T * (-2.1271883786659866e-06 + T * (1.1851179321917346e-09 + -2.6210565749638660e-13 * T))) - 7.2900089399999997e+03 / T);
   } else {
@@ -1338,9 +1393,14 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[166] - rev_rates[165]);
   j_temp = -mw_avg * rho_inv * pres_mod[25] * (2.0 * fwd_rates[166] - 3.0 * rev_rates[165]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[297];
+#else
   kf = exp(3.2862129732783131e+01 - 1.0 * logT - (8.5547326026057672e+03 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  -1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -1507,6 +1567,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 167 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[258];
+#else
   if (T <= 1000.0) {
     Kc = (2.9533429000000044e-01 + -1.2231072000000021e-01 * logT + T * (4.4059264500000009e-04 + T * (-2.4202386333333343e-07 + T * (-3.1139927166666694e-11 + 4.0320486050000086e-14 * T))) - -1.6824899359999999e+04 / T);
   } else {
@@ -1514,8 +1577,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[167] - 2.0 * rev_rates[166]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[298];
+#else
   kf = exp(2.3322244942994260e+01 - (2.0128782594366510e+02 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  -1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -1734,6 +1802,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 168 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[259];
+#else
   if (T <= 1000.0) {
     Kc = (-6.2603984300000004e+00 + 1.4491756199999997e+00 * logT + T * (-8.6287215400000002e-03 + T * (7.1167116633333333e-06 + T * (-3.5058682675000000e-09 + 7.4280576450000006e-13 * T))) - -9.7562914300000011e+03 / T);
   } else {
@@ -1741,8 +1812,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[168] - 2.0 * rev_rates[167]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[299];
+#else
   kf = exp(2.3613637594842576e+01 - (4.5289760837324650e+02 / T));
+#endif
   kr = kf / Kc;
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
   jac[72] +=  -1.5394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -1961,6 +2037,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 169 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[260];
+#else
   if (T <= 1000.0) {
     Kc = (-1.5697238179999999e+01 + 3.2068607999999998e+00 * logT + T * (-9.4386575199999993e-03 + T * (7.2157526483333326e-06 + T * (-3.7621653674999999e-09 + 8.5750890350000011e-13 * T))) - -1.3928806200000001e+04 / T);
   } else {
@@ -1968,8 +2047,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[169] - 2.0 * rev_rates[168]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[300];
+#else
   kf = exp(-3.5387408478311023e+01 + 7.6 * logT - (-1.7763650639528446e+03 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2188,6 +2272,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 170 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[261];
+#else
   if (T <= 1000.0) {
     Kc = (-4.1064640199999998e+00 + 1.1286056200000005e+00 * logT + T * (-7.1337529699999997e-03 + T * (5.5710678366666671e-06 + T * (-2.6837677355000001e-09 + 5.5613434404999995e-13 * T))) - -7.6279970679999999e+04 / T);
   } else {
@@ -2195,8 +2282,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[170] - 2.0 * rev_rates[169]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[301];
+#else
   kf = exp(2.3025850929940457e+01 - (-3.7993077146866790e+02 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2415,6 +2507,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 171 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[262];
+#else
   if (T <= 1000.0) {
     Kc = (8.5123549849999982e+00 + -1.9253073560000000e+00 * logT + T * (9.8554052535266765e-04 + T * (2.0729865996673473e-06 + T * (-1.8017558498082654e-09 + 4.9042694845361333e-13 * T))) - -1.4018817427000002e+04 / T);
   } else {
@@ -2422,8 +2517,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[171] - 2.0 * rev_rates[170]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[302];
+#else
   kf = exp(1.7855046883691379e+01 + 0.9 * logT - (1.0029165927643113e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[21]);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + kf * conc[21]);
@@ -2642,6 +2742,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 172 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[263];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0191016829999999e+01 + 2.0199861800000010e+00 * logT + T * (-5.8351582350000004e-03 + T * (2.5556170316666676e-06 + T * (-4.8298796750000010e-10 + -2.2193090999999984e-14 * T))) - -4.4265294979999999e+04 / T);
   } else {
@@ -2649,8 +2752,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[172] - 2.0 * rev_rates[171]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[303];
+#else
   kf = exp(3.1455305207048688e+01 - 1.39 * logT - (5.1076785833205020e+02 / T));
+#endif
   kr = kf / Kc;
   jac[70] +=  1.4394874694922315e+01 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2874,6 +2982,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 173 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[264];
+#else
   if (T <= 1000.0) {
     Kc = (1.1331573643999999e+01 + -1.8061892659999998e+00 * logT + T * (1.9456303059999999e-02 + T * (-1.8682393616666667e-05 + T * (9.7776106999999999e-09 + -2.1432642325000001e-12 * T))) - 2.0421269596999999e+04 / T);
   } else {
@@ -2881,10 +2992,15 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[173] - rev_rates[172]);
   j_temp = -mw_avg * rho_inv * pres_mod[26] * (fwd_rates[173] - 2.0 * rev_rates[172] + pres_mod_temp);
   pres_mod_temp *= exp(8.1271046653144680e+01 - 9.74 * logT - (5.5505118003965690e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[304];
+#else
   kf = exp(2.9710462657608385e+01 + 0.44 * logT - (4.3664361642829550e+04 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[26] * (-kr * conc[22]));
   jac[54] +=  (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[26] * (-kr * conc[22]));
@@ -3051,6 +3167,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 174 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[265];
+#else
   if (T <= 1000.0) {
     Kc = (-7.2296901000000036e-01 + 1.7207745000000019e-01 * logT + T * (-2.5681599500000001e-03 + T * (3.1159559316666656e-06 + T * (-1.9867757508333335e-09 + 4.9930298850000008e-13 * T))) - -6.3930989700000009e+03 / T);
   } else {
@@ -3058,8 +3177,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[174] - 2.0 * rev_rates[173]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[305];
+#else
   kf = exp(2.0548912449801634e+01 - (1.9499758138292557e+03 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[79] +=  -1.4416383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3278,6 +3402,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.0 * 2.8010399999999997e+01;
 
   //partial of rxn 175 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[266];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4352104238000001e+01 + 4.1169046099999989e+00 * logT + T * (-9.1401558600000005e-03 + T * (3.4222276766666667e-06 + T * (-8.0513212266666674e-10 + 6.8900921600000050e-14 * T))) - -4.4068596879999997e+04 / T);
   } else {
@@ -3285,8 +3412,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[175] - 3.0 * rev_rates[174]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[306];
+#else
   kf = exp(2.1886416646752092e+01 - (4.2974950838972501e+02 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[81] +=  -2.0353066650792705e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3504,6 +3636,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[23] += j_temp * 2.6037879999999998e+01;
 
   //partial of rxn 176 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[267];
+#else
   if (T <= 1000.0) {
     Kc = (-7.4886155739999989e+00 + 2.4643052339999993e+00 * logT + T * (-6.5845932300000014e-03 + T * (2.3291081933333327e-06 + T * (-3.9352187766666722e-10 + -8.8308268999998846e-15 * T))) - -4.2378089300000007e+04 / T);
   } else {
@@ -3511,6 +3646,7 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[176] - 3.0 * rev_rates[175]);
   kf = 10000000000.0;
   kr = kf / Kc;
@@ -3679,6 +3815,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[31] = -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 177 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[268];
+#else
   if (T <= 1000.0) {
     Kc = (-2.2091744000000002e-01 + -2.5153219999999976e-01 * logT + T * (1.3839487800000002e-03 + T * (-1.3935300066666667e-06 + T * (7.3746534666666676e-10 + -1.5678856450000000e-13 * T))) - -3.7847900699999998e+04 / T);
   } else {
@@ -3686,8 +3825,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[177] - 2.0 * rev_rates[176]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[307];
+#else
   kf = exp(2.4019102702950740e+01 - (1.7864294552500277e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[2]));
   jac[89] =  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[2]));
@@ -3906,6 +4050,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[31] += -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 178 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[269];
+#else
   if (T <= 1000.0) {
     Kc = (-4.6230916099999995e+00 + 1.1042870400000004e+00 * logT + T * (-2.4607803399999996e-03 + T * (1.3061306583333336e-06 + T * (-4.8190887916666673e-10 + 8.3625417000000004e-14 * T))) - -1.6073811240000003e+04 / T);
   } else {
@@ -3913,8 +4060,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[178] - 2.0 * rev_rates[177]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[308];
+#else
   kf = exp(1.6012735135300492e+01 + 1.0 * logT - (3.2709271715845580e+03 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4133,6 +4285,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[31] += -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 179 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[270];
+#else
   if (T <= 1000.0) {
     Kc = (-2.4822805649999991e+00 + 2.2646086999999993e-01 * logT + T * (-1.1188292396473339e-03 + T * (1.0705139313340135e-06 + T * (-4.5458350564159866e-10 + 7.1973114953613397e-14 * T))) - -2.4401434660000003e+04 / T);
   } else {
@@ -4140,8 +4295,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[179] - 2.0 * rev_rates[178]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[309];
+#else
   kf = exp(2.4237791903915571e+01 - (1.9373953247077765e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4360,6 +4520,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[38] = -j_temp * 4.4012880000000003e+01;
 
   //partial of rxn 180 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[271];
+#else
   if (T <= 1000.0) {
     Kc = (-6.8575937899999992e+00 + 1.6557160600000000e+00 * logT + T * (-4.8069514600000002e-03 + T * (2.1520558416666665e-06 + T * (-6.3280787083333342e-10 + 8.0846643000000009e-14 * T))) - -3.9948877059999999e+04 / T);
   } else {
@@ -4367,8 +4530,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[180] - 2.0 * rev_rates[179]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[310];
+#else
   kf = exp(2.1059738073567623e+01 - (5.4398034961275489e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[3]));
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[3]));
@@ -4586,6 +4754,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[38] += -j_temp * 4.4012880000000003e+01;
 
   //partial of rxn 181 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[272];
+#else
   if (T <= 1000.0) {
     Kc = (-1.1259767960000000e+01 + 3.0115353000000002e+00 * logT + T * (-8.6516805800000013e-03 + T * (4.8517165066666658e-06 + T * (-1.8521820966666668e-09 + 3.2126062450000001e-13 * T))) - -1.8174787600000003e+04 / T);
   } else {
@@ -4593,8 +4764,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[181] - 2.0 * rev_rates[180]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[311];
+#else
   kf = exp(2.4090561666932885e+01 - (1.1649532926489617e+04 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  2.9769768041748517e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4761,6 +4937,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[38] += -j_temp * 4.4012880000000003e+01;
 
   //partial of rxn 182 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[273];
+#else
   if (T <= 1000.0) {
     Kc = (-8.9984048350000005e+00 + 2.5335422300000001e+00 * logT + T * (-6.1489025603526665e-03 + T * (2.3876725686659865e-06 + T * (-6.6013324435840145e-10 + 9.2498945046386616e-14 * T))) - -3.1621253640000003e+04 / T);
   } else {
@@ -4768,8 +4947,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[182] - 2.0 * rev_rates[181]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[312];
+#else
   kf = exp(2.6681690529976194e+01 - (9.5007853845409918e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[4]));
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[4]));
@@ -4988,6 +5172,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 183 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[274];
+#else
   if (T <= 1000.0) {
     Kc = (-4.3383414719999998e+00 + 1.3513093799999996e+00 * logT + T * (-6.1221452950000000e-03 + T * (4.3747412816666657e-06 + T * (-2.0363101391666670e-09 + 4.2070003700000005e-13 * T))) - -1.3082946820000001e+04 / T);
   } else {
@@ -4995,8 +5182,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[183] - 2.0 * rev_rates[182]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[313];
+#else
   kf = exp(2.1416413017506358e+01 - (1.0597804035933967e+04 / T));
+#endif
   kr = kf / Kc;
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[6]));
   jac[91] +=  -2.1833085302696588e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[6]));
@@ -5216,6 +5408,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[38] += -j_temp * 4.4012880000000003e+01;
 
   //partial of rxn 184 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[275];
+#else
   if (T <= 1000.0) {
     Kc = (-8.9654804400000003e+00 + 3.2097939000000002e+00 * logT + T * (-6.5879032200000000e-03 + T * (2.7251934933333331e-06 + T * (-8.4737765333333335e-10 + 1.2992619550000000e-13 * T))) - 1.9359584900000002e+04 / T);
   } else {
@@ -5223,10 +5418,15 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr))) * (fwd_rates[184] - rev_rates[183]);
   j_temp = -mw_avg * rho_inv * pres_mod[27] * (fwd_rates[184] - 2.0 * rev_rates[183] + pres_mod_temp);
   pres_mod_temp *= exp(2.0860567807985553e+00 - (3.1199613021268306e+02 / T)) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[314];
+#else
   kf = exp(2.5093978711720020e+01 - (2.8190360023410296e+04 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[27] * (-7.1961070170503627e-02 * (-kr * conc[2])));
   J_nplusjplus[0] +=  1.3896402563644662e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[27] * (-7.1961070170503627e-02 * (-kr * conc[2])));
@@ -5393,6 +5593,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 185 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[276];
+#else
   if (T <= 1000.0) {
     Kc = (7.9478507199999937e-01 + -5.8422767999999969e-01 * logT + T * (2.7006749950000001e-03 + T * (-1.8205934483333328e-06 + T * (7.7133045583333352e-10 + -1.4483285700000006e-13 * T))) - -3.6277325799999994e+03 / T);
   } else {
@@ -5400,8 +5603,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[185] - 2.0 * rev_rates[184]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[315];
+#else
   kf = exp(2.1469953784434388e+01 - (-2.4154539113239812e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[90] =  2.2821566759926181e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5619,6 +5827,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[37] += j_temp * 4.6005539999999996e+01;
 
   //partial of rxn 186 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[277];
+#else
   if (T <= 1000.0) {
     Kc = (5.4219240400000004e+00 + -2.4427122000000003e+00 * logT + T * (3.1664329199999996e-03 + T * (-1.7104566000000018e-07 + T * (-4.1760202999999983e-10 + 1.4594098449999999e-13 * T))) - -3.6070264300000003e+04 / T);
   } else {
@@ -5626,9 +5837,14 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[186] - rev_rates[185]);
   j_temp = -mw_avg * rho_inv * pres_mod[28] * (3.0 * fwd_rates[186] - 2.0 * rev_rates[185]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[316];
+#else
   kf = exp(3.2294460210040619e+01 - 1.41 * logT);
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -5795,6 +6011,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[37] += -j_temp * 4.6005539999999996e+01;
 
   //partial of rxn 187 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[278];
+#else
   if (T <= 1000.0) {
     Kc = (-3.3140373899999997e+00 + 8.8863435999999973e-01 * logT + T * (-1.3854811599999998e-03 + T * (-4.0209199166666680e-07 + T * (6.3217181249999985e-10 + -1.9502053699999998e-13 * T))) - -2.3238197660000002e+04 / T);
   } else {
@@ -5802,8 +6021,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[187] - 2.0 * rev_rates[186]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[317];
+#else
   kf = exp(2.2084242390082011e+01 - (-1.2077269556619906e+02 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6022,6 +6246,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 188 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[279];
+#else
   if (T <= 1000.0) {
     Kc = (-5.4548484350000006e+00 + 1.7664605299999998e+00 * logT + T * (-2.7274322603526666e-03 + T * (-1.6647526466734673e-07 + T * (6.0484643897493183e-10 + -1.8336823495361339e-13 * T))) - -1.4910574240000000e+04 / T);
   } else {
@@ -6029,8 +6256,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[188] - 2.0 * rev_rates[187]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[318];
+#else
   kf = exp(2.5606067759532781e+01 - (1.8115904334929860e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6249,6 +6481,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] = -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 189 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[280];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1233984129999994e+00 + 5.7300699999999871e-02 * logT + T * (-8.3572456964733379e-04 + T * (9.8116773966734676e-07 + T * (-4.7414277980826538e-10 + 8.6330699453613401e-14 * T))) - -3.5684605300000003e+04 / T);
   } else {
@@ -6256,6 +6491,7 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[189] - 2.0 * rev_rates[188]);
   kf = 40000000000.0;
   kr = kf / Kc;
@@ -6476,6 +6712,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 190 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[281];
+#else
   if (T <= 1000.0) {
     Kc = (4.6238513709999998e+00 + -1.1485773799999999e+00 * logT + T * (3.8343643846473329e-03 + T * (-2.9981837663340132e-06 + T * (1.4729637664749321e-09 + -3.1702104545361340e-13 * T))) - -1.2167587072999999e+04 / T);
   } else {
@@ -6483,8 +6722,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[190] - 2.0 * rev_rates[189]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[319];
+#else
   kf = exp(2.4189001739746139e+01 - (1.6606245640352370e+02 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[30]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[30]);
@@ -6703,6 +6947,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 191 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[282];
+#else
   if (T <= 1000.0) {
     Kc = (1.0188835000000784e-02 + -4.5143233000000027e-01 * logT + T * (-1.7900457796473333e-03 + T * (2.5573861646673468e-06 + T * (-1.3114670723082653e-09 + 2.6085196495361340e-13 * T))) - -8.4737526599999983e+03 / T);
   } else {
@@ -6710,6 +6957,7 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[191] - 2.0 * rev_rates[190]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -6930,6 +7178,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 192 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[283];
+#else
   if (T <= 1000.0) {
     Kc = (2.3867575199999997e+00 + -7.8628336999999959e-01 * logT + T * (2.6545719999999966e-05 + T * (5.6525201666666672e-07 + T * (-3.4070679083333331e-10 + 7.2178008500000003e-14 * T))) - -1.9684799260000000e+04 / T);
   } else {
@@ -6937,8 +7188,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[192] - 2.0 * rev_rates[191]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[320];
+#else
   kf = exp(1.4508657738524219e+01 + 1.2 * logT);
+#endif
   kr = kf / Kc;
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7157,6 +7413,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 193 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[284];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1306222099999994e+00 + 4.2639383999999980e-01 * logT + T * (-3.1319968799999997e-03 + T * (2.7930028916666668e-06 + T * (-1.3387924458333333e-09 + 2.7250426700000000e-13 * T))) - -1.4612924000000203e+02 / T);
   } else {
@@ -7164,8 +7423,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[193] - 2.0 * rev_rates[192]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[321];
+#else
   kf = exp(6.1333980429966486e+00 + 2.0 * logT - (3.2709271715845580e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7384,6 +7648,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 194 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[285];
+#else
   if (T <= 1000.0) {
     Kc = (-4.2642094580000007e+00 + 9.3512686999999994e-01 * logT + T * (-2.1776756700000004e-03 + T * (1.2167844666666667e-06 + T * (-5.0146815333333330e-10 + 9.7983001500000008e-14 * T))) - -2.7356981879999999e+04 / T);
   } else {
@@ -7391,8 +7658,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[194] - 2.0 * rev_rates[193]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[322];
+#else
   kf = exp(7.1546153569136628e+00 + 1.5 * logT - (5.0321956485916274e+01 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7611,6 +7883,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 195 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[286];
+#else
   if (T <= 1000.0) {
     Kc = (-2.3443158529999994e+00 + -1.9423149999999989e-01 * logT + T * (5.4822421035266632e-04 + T * (-4.1236226699931982e-07 + T * (2.6332256685840138e-10 + -7.0457865046386596e-14 * T))) - -7.3532506000000008e+04 / T);
   } else {
@@ -7618,6 +7893,7 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[195] - 2.0 * rev_rates[194]);
   kf = 15000000000.0;
   kr = kf / Kc;
@@ -7838,6 +8114,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 196 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[287];
+#else
   if (T <= 1000.0) {
     Kc = (2.2472826860000001e+00 + -8.1372634000000055e-01 * logT + T * (2.0177728849999996e-03 + T * (-1.0060496183333333e-06 + T * (5.0220348500000010e-10 + -1.2834708900000004e-13 * T))) - -9.5654047300000093e+02 / T);
   } else {
@@ -7845,8 +8124,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[196] - 2.0 * rev_rates[195]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[323];
+#else
   kf = exp(2.3718998110500401e+01 - (6.9695909732994041e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[38]);
   jac[59] +=  -8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01 - kr * conc[38]);
@@ -8065,6 +8349,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 197 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[288];
+#else
   if (T <= 1000.0) {
     Kc = (1.3796471199999938e-01 + -4.2069236999999982e-01 * logT + T * (1.6670534500000001e-03 + T * (-1.4828761983333330e-06 + T * (7.1790607249999988e-10 + -1.4243097999999998e-13 * T))) - -4.9131071340000002e+04 / T);
   } else {
@@ -8072,8 +8359,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[197] - 2.0 * rev_rates[196]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[324];
+#else
   kf = exp(2.3795959151636531e+01 - 0.23 * logT);
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[4]));
   J_nplusjplus[0] +=  1.3896402563644662e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[4]));
@@ -8292,6 +8584,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 198 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[289];
+#else
   if (T <= 1000.0) {
     Kc = (9.1363695469999993e+00 + -2.9542345999999999e+00 * logT + T * (7.8159560103526673e-03 + T * (-3.8705487669993199e-06 + T * (1.3780393168584015e-09 + -2.3492992504638663e-13 * T))) - -1.7509817700000000e+04 / T);
   } else {
@@ -8299,8 +8594,13 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[198] - 2.0 * rev_rates[197]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[325];
+#else
   kf = exp(2.6623163190528903e+01 - 0.45 * logT);
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -8519,6 +8819,9 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 199 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[290];
+#else
   if (T <= 1000.0) {
     Kc = (-2.7834256799999957e-01 + 1.1265392999999957e-01 * logT + T * (1.6479659000000000e-03 + T * (-1.7701681250000003e-06 + T * (8.6167473416666670e-10 + -1.7141567050000001e-13 * T))) - -5.5124596400000009e+03 / T);
   } else {
@@ -8526,6 +8829,7 @@ void eval_jacob_4 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[199] - 2.0 * rev_rates[198]);
   kf = 3000000000.0;
   kr = kf / Kc;
@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_5 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac, double * __restrict__ J_nplusone, double * __restrict__ J_nplusjplus) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -19,6 +23,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[39] += j_temp * 3.1014080000000000e+01;
 
   //partial of rxn 200 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[326];
+#else
   if (T <= 1000.0) {
     Kc = (-2.6815373299999923e-01 + -3.3877840000000026e-01 * logT + T * (-1.4207987964733309e-04 + T * (7.8721803966734651e-07 + T * (-4.4979233814159858e-10 + 8.9436294453613392e-14 * T))) - -1.3986212300000001e+04 / T);
   } else {
@@ -26,6 +33,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[200] - 2.0 * rev_rates[199]);
   kf = 39000000000.0;
   kr = kf / Kc;
@@ -246,6 +254,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 201 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[327];
+#else
   if (T <= 1000.0) {
     Kc = (3.9866266510000008e+00 + -8.6676327999999980e-01 * logT + T * (5.1992256146473331e-03 + T * (-4.6790056996673460e-06 + T * (2.3541977748082650e-09 + -5.0279430045361343e-13 * T))) - -6.3968760729999995e+03 / T);
   } else {
@@ -253,8 +264,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[201] - 2.0 * rev_rates[200]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[365];
+#else
   kf = exp(2.4412145291060348e+01 - (1.8367514117359440e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  -7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01 - kr * conc[31]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[31]);
@@ -473,6 +489,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 202 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[328];
+#else
   if (T <= 1000.0) {
     Kc = (1.7495328000000014e+00 + -5.0446926999999908e-01 * logT + T * (1.3914069499999999e-03 + T * (-1.1155699166666667e-06 + T * (5.4052721750000006e-10 + -1.1359524649999998e-13 * T))) - -1.3914088259999997e+04 / T);
   } else {
@@ -480,8 +499,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[202] - 2.0 * rev_rates[201]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[366];
+#else
   kf = exp(1.1407564949312402e+01 + 1.5 * logT - (-2.3148099983521487e+02 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  -7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -699,6 +723,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 203 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[329];
+#else
   if (T <= 1000.0) {
     Kc = (-9.2823615299999940e-01 + 4.5398429999999967e-01 * logT + T * (3.1289738003526663e-03 + T * (-4.0037801669993201e-06 + T * (2.2806649168584014e-09 + -5.1959039504638663e-13 * T))) - -4.3392130000000034e+03 / T);
   } else {
@@ -706,6 +733,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (fwd_rates[203] - 2.0 * rev_rates[202]);
   kf = 330000000.0;
   kr = kf / Kc;
@@ -873,6 +901,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 204 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[329];
+#else
   if (T <= 1000.0) {
     Kc = (-9.2823615299999940e-01 + 4.5398429999999967e-01 * logT + T * (3.1289738003526663e-03 + T * (-4.0037801669993201e-06 + T * (2.2806649168584014e-09 + -5.1959039504638663e-13 * T))) - -4.3392130000000034e+03 / T);
   } else {
@@ -880,9 +911,14 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[204] - rev_rates[203]);
   j_temp = -mw_avg * rho_inv * pres_mod[29] * (2.0 * fwd_rates[204] - 3.0 * rev_rates[203]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[367];
+#else
   kf = exp(2.5590800287401994e+01 - 0.11 * logT - (2.5060334329986304e+03 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[29] * (-7.1961070170503627e-02 * (-kr * conc[1])));
   jac[88] +=  -1.4396402563644662e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[29] * (-7.1961070170503627e-02 * (-kr * conc[1])));
@@ -1049,6 +1085,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 205 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[330];
+#else
   if (T <= 1000.0) {
     Kc = (1.5580917700000008e+00 + -5.2667405000000089e-01 * logT + T * (2.2527806249999999e-03 + T * (-2.1186156516666675e-06 + T * (1.0644070574999998e-09 + -2.1716425150000004e-13 * T))) - -2.8454121300000003e+04 / T);
   } else {
@@ -1056,6 +1095,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[205] - 2.0 * rev_rates[204]);
   kf = 5000000000.0;
   kr = kf / Kc;
@@ -1276,6 +1316,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 206 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[331];
+#else
   if (T <= 1000.0) {
     Kc = (-9.6116054799999961e-01 + -2.2226737000000085e-01 * logT + T * (3.5679744600000006e-03 + T * (-4.3413010916666667e-06 + T * (2.4679093258333334e-09 + -5.5701764549999998e-13 * T))) - -5.5320051539999993e+04 / T);
   } else {
@@ -1283,6 +1326,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[206] - 2.0 * rev_rates[205]);
   kf = 25000000000.0;
   kr = kf / Kc;
@@ -1503,6 +1547,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 207 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[332];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0991252599999990e+00 + 1.9842499999999941e-01 * logT + T * (1.9009210099999998e-03 + T * (-2.8584248933333333e-06 + T * (1.7500032533333335e-09 + -4.1458666550000000e-13 * T))) - -6.1889802000000054e+03 / T);
   } else {
@@ -1510,6 +1557,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[207] - 2.0 * rev_rates[206]);
   kf = 70000000000.0;
   kr = kf / Kc;
@@ -1730,6 +1778,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 208 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[333];
+#else
   if (T <= 1000.0) {
     Kc = (3.3038086710000005e+00 + -1.2016845800000002e+00 * logT + T * (7.1192341746473334e-03 + T * (-7.2501386663340136e-06 + T * (3.9604323664749323e-09 + -8.8839627545361345e-13 * T))) - -5.6204467972999999e+04 / T);
   } else {
@@ -1737,6 +1788,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[208] - 2.0 * rev_rates[207]);
   kf = 50000000000.0;
   kr = kf / Kc;
@@ -1957,6 +2009,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 209 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[334];
+#else
   if (T <= 1000.0) {
     Kc = (1.0667148200000014e+00 + -8.3939056999999950e-01 * logT + T * (3.3114155100000004e-03 + T * (-3.6867028833333326e-06 + T * (2.1467618091666670e-09 + -4.9919722149999996e-13 * T))) - -6.3721680159999996e+04 / T);
   } else {
@@ -1964,6 +2019,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[209] - 2.0 * rev_rates[208]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -2184,6 +2240,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 210 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[335];
+#else
   if (T <= 1000.0) {
     Kc = (-5.7037071199999980e+00 + 4.3027002999999953e-01 * logT + T * (-4.7119914749999998e-03 + T * (3.2378600566666669e-06 + T * (-1.1862624458333336e-09 + 1.8668651799999997e-13 * T))) - -5.6504519299999993e+04 / T);
   } else {
@@ -2191,6 +2250,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[210] - 2.0 * rev_rates[209]);
   kf = 25000000000.0;
   kr = kf / Kc;
@@ -2410,6 +2470,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[39] += j_temp * 3.1014080000000000e+01;
 
   //partial of rxn 211 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[336];
+#else
   if (T <= 1000.0) {
     Kc = (2.1006628530000002e+00 + -1.1849847000000002e+00 * logT + T * (-5.1532055035266588e-04 + T * (1.2386975003326533e-06 + T * (-6.5007988352506800e-10 + 1.3709401504638660e-13 * T))) - -2.3769985900000000e+04 / T);
   } else {
@@ -2417,9 +2480,14 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[211] - rev_rates[210]);
   j_temp = -mw_avg * rho_inv * pres_mod[30] * (3.0 * fwd_rates[211] - 2.0 * rev_rates[210]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[368];
+#else
   kf = exp(3.1433229255349488e+01 - 1.32 * logT - (3.7238247799578045e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -2586,6 +2654,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[39] += -j_temp * 3.1014080000000000e+01;
 
   //partial of rxn 212 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[337];
+#else
   if (T <= 1000.0) {
     Kc = (-2.1335872480000004e+00 + 5.0873303000000014e-01 * logT + T * (9.5432120999999954e-04 + T * (-1.5762184250000001e-06 + T * (8.3732429250000000e-10 + -1.7452126549999997e-13 * T))) - -2.7210852640000001e+04 / T);
   } else {
@@ -2593,6 +2664,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[212] - 2.0 * rev_rates[211]);
   kf = 25000000000.0;
   kr = kf / Kc;
@@ -2813,6 +2885,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[39] += -j_temp * 3.1014080000000000e+01;
 
   //partial of rxn 213 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[338];
+#else
   if (T <= 1000.0) {
     Kc = (2.1313819709999997e+00 + -4.7068417999999967e-01 * logT + T * (4.5055809246473330e-03 + T * (-4.4850559996673466e-06 + T * (2.3298473331415985e-09 + -5.0589989545361344e-13 * T))) - -2.8095269073000003e+04 / T);
   } else {
@@ -2820,8 +2895,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[213] - 2.0 * rev_rates[212]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[369];
+#else
   kf = exp(2.0617905321288585e+01 + 0.72 * logT - (3.3212491280704739e+02 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[35]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[35]);
@@ -3040,6 +3120,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[39] += -j_temp * 3.1014080000000000e+01;
 
   //partial of rxn 214 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[339];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0571187999999987e-01 + -1.0839016999999940e-01 * logT + T * (6.9776225999999960e-04 + T * (-9.2162021666666645e-07 + T * (5.1617677583333336e-10 + -1.1670084150000000e-13 * T))) - -3.5612481260000000e+04 / T);
   } else {
@@ -3047,8 +3130,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[214] - 2.0 * rev_rates[213]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[370];
+#else
   kf = exp(9.4727046364436731e+00 + 1.9 * logT - (-4.7805858661620459e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3267,6 +3355,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[7] += j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 215 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[340];
+#else
   if (T <= 1000.0) {
     Kc = (3.8566506999999994e-01 + 2.0432635000000010e-01 * logT + T * (-3.6087262500000047e-04 + T * (6.4646701499999954e-07 + T * (-5.6617797583333357e-10 + 1.6533212850000007e-13 * T))) - -3.4492240000000118e+02 / T);
   } else {
@@ -3274,8 +3365,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[215] - 2.0 * rev_rates[214]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[371];
+#else
   kf = exp(2.3025850929940457e+01 - (6.5418543431691160e+03 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3494,6 +3590,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] = -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 216 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[341];
+#else
   if (T <= 1000.0) {
     Kc = (2.3715537499999999e+00 + -7.0166873000000018e-01 * logT + T * (1.8122392150000000e-03 + T * (-1.2950912216666667e-06 + T * (6.1251961283333337e-10 + -1.2763903244999998e-13 * T))) - -3.9070048199999990e+04 / T);
   } else {
@@ -3501,6 +3600,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[216] - 2.0 * rev_rates[215]);
   kf = 77000000000.0;
   kr = kf / Kc;
@@ -3721,6 +3821,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 217 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[342];
+#else
   if (T <= 1000.0) {
     Kc = (7.5052274350000010e+00 + -2.2780197300000000e+00 * logT + T * (6.0809997953526667e-03 + T * (-2.5248082519993201e-06 + T * (7.4983274685840136e-10 + -1.1155853204638663e-13 * T))) - -1.5167283659999994e+04 / T);
   } else {
@@ -3728,6 +3831,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[217] - 2.0 * rev_rates[216]);
   kf = 40000000000.0;
   kr = kf / Kc;
@@ -3948,6 +4052,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 218 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[343];
+#else
   if (T <= 1000.0) {
     Kc = (7.2416207799999999e+00 + -1.5605716300000005e+00 * logT + T * (5.3208999249999998e-03 + T * (-2.8997540666666668e-06 + T * (1.0011957933333334e-09 + -1.4762313550000001e-13 * T))) - -3.0868997399999935e+03 / T);
   } else {
@@ -3955,8 +4062,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[218] - 2.0 * rev_rates[217]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[372];
+#else
   kf = exp(2.2802707378626248e+01 - (3.7540179538493539e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] =  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4175,6 +4287,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 219 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[344];
+#else
   if (T <= 1000.0) {
     Kc = (5.3644163899999997e+00 + -1.4001935599999999e+00 * logT + T * (4.7390486950000003e-03 + T * (-2.2891915250000001e-06 + T * (7.2250737333333334e-10 + -9.9906230000000010e-14 * T))) - -6.8396602399999974e+03 / T);
   } else {
@@ -4182,8 +4297,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[219] - 2.0 * rev_rates[218]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[373];
+#else
   kf = exp(2.2538090579105461e+01 - (-2.2141660853803160e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -4402,6 +4522,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 220 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[345];
+#else
   if (T <= 1000.0) {
     Kc = (5.0045269289999998e+00 + -1.1982776200000003e+00 * logT + T * (1.5130812603526670e-03 + T * (6.6368171633401331e-07 + T * (-8.1247476397493195e-10 + 2.4157591845361340e-13 * T))) - -1.0604111926999998e+04 / T);
   } else {
@@ -4409,8 +4532,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[220] - 2.0 * rev_rates[219]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[374];
+#else
   kf = exp(5.6869753563398202e+00 + 2.45 * logT - (1.1272118252845246e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + kf * conc[39]);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + kf * conc[39]);
@@ -4629,6 +4757,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 221 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[346];
+#else
   if (T <= 1000.0) {
     Kc = (-7.6159542499999997e+00 + 1.8028118699999998e+00 * logT + T * (-5.3875898200000010e-03 + T * (2.3002309616666666e-06 + T * (-5.9189663966666670e-10 + 5.5892614550000019e-14 * T))) - -4.8304199200000003e+04 / T);
   } else {
@@ -4636,6 +4767,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[221] - 2.0 * rev_rates[220]);
   kf = 23500000000.0;
   kr = kf / Kc;
@@ -4856,6 +4988,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 222 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[347];
+#else
   if (T <= 1000.0) {
     Kc = (-5.4925558370000003e+00 + 1.7455111699999999e+00 * logT + T * (-4.5518652503526670e-03 + T * (1.3190632219993198e-06 + T * (-1.1775385985840135e-10 + -3.0438084903613376e-14 * T))) - -1.2619593899999993e+04 / T);
   } else {
@@ -4863,6 +4998,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[222] - 2.0 * rev_rates[221]);
   kf = 54000000000.0;
   kr = kf / Kc;
@@ -5084,6 +5220,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 223 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[348];
+#else
   if (T <= 1000.0) {
     Kc = (-7.5830298549999995e+00 + 2.4790635399999998e+00 * logT + T * (-5.8265904796473344e-03 + T * (2.6377518863340136e-06 + T * (-7.7914104864159860e-10 + 9.3319865003613392e-14 * T))) - 2.6766393399999979e+03 / T);
   } else {
@@ -5091,6 +5230,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[223] - 3.0 * rev_rates[222]);
   kf = 2500000000.0;
   kr = kf / Kc;
@@ -5363,6 +5503,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[31] += -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 224 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[349];
+#else
   if (T <= 1000.0) {
     Kc = (-7.8368716899999997e+00 + 1.5512796700000000e+00 * logT + T * (-4.0036410400000003e-03 + T * (9.0670095500000012e-07 + T * (1.4556870700000011e-10 + -1.0089594994999997e-13 * T))) - -8.6152099900000001e+04 / T);
   } else {
@@ -5370,6 +5513,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[224] - 2.0 * rev_rates[223]);
   kf = 20000000000.0;
   kr = kf / Kc;
@@ -5590,6 +5734,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 225 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[350];
+#else
   if (T <= 1000.0) {
     Kc = (-9.9210436999999896e-01 + -3.4137340000000016e-02 * logT + T * (-7.3140693500000058e-04 + T * (4.0946178333333354e-07 + T * (-1.6644554083333330e-10 + 3.7375429100000013e-14 * T))) - -5.2145880140000001e+04 / T);
   } else {
@@ -5597,8 +5744,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[225] - 2.0 * rev_rates[224]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[375];
+#else
   kf = exp(2.1416413017506358e+01 - (1.0064391297183254e+04 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5816,6 +5968,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[31] += j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 226 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[351];
+#else
   if (T <= 1000.0) {
     Kc = (-5.1007492900000004e+00 + 2.2526026699999999e+00 * logT + T * (-4.7077612400000003e-03 + T * (1.5672379550000001e-06 + T * (-3.2455754299999995e-10 + 2.1346750050000008e-14 * T))) - 2.7078074000000001e+04 / T);
   } else {
@@ -5823,9 +5978,14 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[226] - rev_rates[225]);
   j_temp = -mw_avg * rho_inv * pres_mod[31] * (2.0 * fwd_rates[226] - 3.0 * rev_rates[225]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[376];
+#else
   kf = exp(2.6459838134425603e+01 - (2.7199017480637747e+04 / T));
+#endif
   kr = kf / Kc;
   jac[68] +=  1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[100] +=  -2.0843075976744647e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -5992,6 +6152,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 227 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[352];
+#else
   if (T <= 1000.0) {
     Kc = (3.6438137099999990e+00 + -1.2087234300000000e+00 * logT + T * (3.2640907599999994e-03 + T * (-2.5514855449999996e-06 + T * (1.2602854570000002e-09 + -2.6536800995000000e-13 * T))) - -3.0129411599999999e+04 / T);
   } else {
@@ -5999,8 +6162,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[227] - 2.0 * rev_rates[226]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[377];
+#else
   kf = exp(3.2878045188089033e+01 - 1.52 * logT - (3.7238247799578045e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[91] +=  2.1833085302696588e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6219,6 +6387,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 228 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[353];
+#else
   if (T <= 1000.0) {
     Kc = (3.4100697999999996e+00 + -1.3899565799999998e+00 * logT + T * (3.1133221850000001e-03 + T * (-2.2901988816666664e-06 + T * (1.0529286850000000e-09 + -2.0303855239999998e-13 * T))) - -7.3919969600000011e+04 / T);
   } else {
@@ -6226,8 +6397,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[228] - 2.0 * rev_rates[227]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[378];
+#else
   kf = exp(3.5873777461643023e+01 - 2.0 * logT - (4.0257565188733020e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[15]));
   J_nplusjplus[0] +=  1.3896402563644662e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[15]));
@@ -6445,6 +6621,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 229 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[354];
+#else
   if (T <= 1000.0) {
     Kc = (-9.2365717529999998e+00 + 2.8539465000000002e+00 * logT + T * (-5.5033416346473331e-03 + T * (2.5826767830006802e-06 + T * (-8.6729268564159879e-10 + 1.2722996195361339e-13 * T))) - 6.2469366899999994e+04 / T);
   } else {
@@ -6452,9 +6631,14 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[229] - rev_rates[228]);
   j_temp = -mw_avg * rho_inv * pres_mod[32] * (2.0 * fwd_rates[229] - 3.0 * rev_rates[228]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[379];
+#else
   kf = exp(5.9906433130998472e+01 - 3.3 * logT - (6.3707596911170003e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6621,6 +6805,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[47] += j_temp * 4.2017139999999998e+01;
 
   //partial of rxn 230 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[355];
+#else
   if (T <= 1000.0) {
     Kc = (-1.7642687129999999e+00 + -1.0032489999999994e-01 * logT + T * (1.0166588203526670e-03 + T * (-2.7965239366598648e-07 + T * (6.9784470191734520e-11 + -2.1755820546386616e-14 * T))) - -3.6787553000000025e+03 / T);
   } else {
@@ -6628,8 +6815,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[230] - 2.0 * rev_rates[229]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[380];
+#else
   kf = exp(3.0106208860477417e+00 + 2.64 * logT - (2.5060334329986304e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -6848,6 +7040,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 231 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[356];
+#else
   if (T <= 1000.0) {
     Kc = (-7.2568245499999993e+00 + 1.6451862700000000e+00 * logT + T * (-3.5352064300000000e-03 + T * (1.0394108283333334e-06 + T * (-4.7969389666666777e-11 + -5.2193905449999999e-14 * T))) - -1.6298349199999997e+04 / T);
   } else {
@@ -6855,8 +7050,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[231] - 2.0 * rev_rates[230]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[381];
+#else
   kf = exp(1.6233408176030919e+00 + 2.64 * logT - (2.5060334329986304e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7075,6 +7275,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 232 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[357];
+#else
   if (T <= 1000.0) {
     Kc = (-9.2694961480000018e+00 + 2.1776948300000001e+00 * logT + T * (-5.0643409749999996e-03 + T * (2.2451558583333332e-06 + T * (-6.8004827666666689e-10 + 8.9802711500000001e-14 * T))) - 1.1488528359999997e+04 / T);
   } else {
@@ -7082,8 +7285,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[232] - 2.0 * rev_rates[231]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[382];
+#else
   kf = exp(1.5179047931961549e+01 + 1.58 * logT - (1.3385640425253729e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7302,6 +7510,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[45] = j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 233 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[358];
+#else
   if (T <= 1000.0) {
     Kc = (-5.5081952650000003e+00 + -2.7510040299999998e+00 * logT + T * (-3.8249262396473334e-03 + T * (1.4556374313340135e-06 + T * (-5.1760130564159879e-10 + 8.2239404953613387e-14 * T))) - 7.1459463399999986e+03 / T);
   } else {
@@ -7315,8 +7526,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[233] - 2.0 * rev_rates[232]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[383];
+#else
   kf = exp(7.0030654587864616e+00 + 2.03 * logT - (6.7280455821670057e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -7535,6 +7751,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[46] = j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 234 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[359];
+#else
   if (T <= 1000.0) {
     Kc = (-5.5081952650000003e+00 + -2.7510040299999998e+00 * logT + T * (-3.8249262396473334e-03 + T * (1.4556374313340135e-06 + T * (-5.1760130564159879e-10 + 8.2239404953613387e-14 * T))) - 7.1459463399999986e+03 / T);
   } else {
@@ -7548,8 +7767,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[234] - 2.0 * rev_rates[233]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[384];
+#else
   kf = exp(1.4816045409242156e+00 + 2.26 * logT - (3.2206052150986416e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -7768,6 +7992,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 235 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[360];
+#else
   if (T <= 1000.0) {
     Kc = (-6.9784819819999999e+00 + 1.5325323399999999e+00 * logT + T * (-5.1831723300000002e-03 + T * (2.8095789533333332e-06 + T * (-9.0964412383333345e-10 + 1.1922176505000000e-13 * T))) - -1.0785889560000000e+04 / T);
   } else {
@@ -7775,8 +8002,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[235] - 2.0 * rev_rates[234]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[385];
+#else
   kf = exp(-1.8325814637483102e+00 + 2.56 * logT - (4.5289760837324648e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  -1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7996,6 +8228,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[42] = j_temp * 2.8033619999999999e+01;
 
   //partial of rxn 236 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[361];
+#else
   if (T <= 1000.0) {
     Kc = (2.4303196529999993e+00 + -9.0732759999999990e-01 * logT + T * (-2.1779684503526668e-03 + T * (2.4038171669993197e-06 + T * (-9.7624675019173469e-10 + 1.3868959954638661e-13 * T))) - -1.1548472900000001e+04 / T);
   } else {
@@ -8003,6 +8238,7 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr))) * (fwd_rates[236] - rev_rates[235]);
   j_temp = -mw_avg * rho_inv * pres_mod[33] * (2.0 * fwd_rates[236] - rev_rates[235] + pres_mod_temp);
   pres_mod_temp *= exp(2.2168400698089236e+01 - 3.4 * logT - (9.5611717323240919e+02 / T)) / (1.0 + Pr);
@@ -8173,6 +8409,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[31] += -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 237 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[362];
+#else
   if (T <= 1000.0) {
     Kc = (-9.3834506199999996e+00 + 1.7096946700000002e+00 * logT + T * (-1.6590602784999999e-03 + T * (-3.7324393166666659e-07 + T * (2.8443462249999998e-10 + -2.6116299999999991e-14 * T))) - -3.9759316800000001e+04 / T);
   } else {
@@ -8180,8 +8419,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[237] - 2.0 * rev_rates[236]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[386];
+#else
   kf = exp(2.4817610399168512e+01 - (2.0128782594366510e+02 / T));
+#endif
   kr = kf / Kc;
   jac[95] +=  -1.3906393237692718e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[10]));
   jac[64] +=  6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (-kr * conc[10]));
@@ -8400,6 +8644,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[40] += j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 238 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[363];
+#else
   if (T <= 1000.0) {
     Kc = (-5.6729083000000013e-01 + 2.6001854999999985e-01 * logT + T * (-1.0211079730000001e-03 + T * (8.9562124249999987e-07 + T * (-4.3537027841666673e-10 + 8.5701449699999992e-14 * T))) - 2.3389993700000006e+04 / T);
   } else {
@@ -8407,8 +8654,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[238] - 2.0 * rev_rates[237]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[387];
+#else
   kf = exp(2.4866400563337944e+01 - (2.3158164374818669e+04 / T));
+#endif
   kr = kf / Kc;
   jac[62] +=  -5.9581919558703884e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[8]));
   J_nplusjplus[0] +=  -1.3896402563644662e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[8]));
@@ -8627,6 +8879,9 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   jac[31] += j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 239 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[364];
+#else
   if (T <= 1000.0) {
     Kc = (9.1054725699999999e+00 + -2.0295050500000000e+00 * logT + T * (4.1595470295000001e-03 + T * (-1.2832583916666670e-06 + T * (1.0738839416666668e-10 + 4.2102093499999997e-14 * T))) - 1.0408765000000058e+03 / T);
   } else {
@@ -8634,8 +8889,13 @@ void eval_jacob_5 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[239] - 2.0 * rev_rates[238]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[388];
+#else
   kf = exp(1.4953343559785665e+01 + 0.88 * logT - (1.0129809840614946e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[9]));
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[9]));
@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_6 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac, double * __restrict__ J_nplusone, double * __restrict__ J_nplusjplus) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -28,6 +32,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = -j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 240 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[389];
+#else
   if (T <= 1000.0) {
     Kc = (9.9056611700000001e+00 + -3.2641742499999999e+00 * logT + T * (7.1142715294999995e-03 + T * (-2.1940235583333335e-06 + T * (2.7682097750000004e-10 + 3.0760343499999991e-14 * T))) - -1.5514409499999998e+04 / T);
   } else {
@@ -35,10 +42,15 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[240] - rev_rates[239]);
   j_temp = -mw_avg * rho_inv * pres_mod[34] * (2.0 * fwd_rates[240] - rev_rates[239] + pres_mod_temp);
   pres_mod_temp *= exp(2.2156813082916848e+01 - 3.31 * logT - (3.7238247799578045e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[429];
+#else
   kf = exp(2.1854667948437513e+01 + 0.15 * logT);
+#endif
   kr = kf / Kc;
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[34] * (-7.1961070170503627e-02 * (kf * conc[9])));
   jac[96] =  2.0354594519515047e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[34] * (-7.1961070170503627e-02 * (kf * conc[9])));
@@ -205,6 +217,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 241 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[390];
+#else
   if (T <= 1000.0) {
     Kc = (6.5613244200000009e+00 + -1.3094585700000003e+00 * logT + T * (3.9929247185000001e-03 + T * (-2.2787479683333335e-06 + T * (8.9861581083333338e-10 + -1.6435813450000000e-13 * T))) - 1.1610121800000004e+04 / T);
   } else {
@@ -212,8 +227,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[241] - 2.0 * rev_rates[240]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[430];
+#else
   kf = exp(2.3025850929940457e+01 - (3.7238247799578043e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[10]));
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[10]));
@@ -432,6 +452,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 242 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[391];
+#else
   if (T <= 1000.0) {
     Kc = (9.3289006769999983e+00 + -1.7453840100000000e+00 * logT + T * (5.6606678849999998e-03 + T * (-3.1850919333333334e-06 + T * (1.1350531675000000e-09 + -1.7714464350000000e-13 * T))) - 7.1173456000000006e+03 / T);
   } else {
@@ -439,8 +462,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[242] - 2.0 * rev_rates[241]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[431];
+#else
   kf = exp(1.8420680743952367e+01 - (3.2709271715845578e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[11]));
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01 - 7.1961070170503627e-02 * (kf * conc[11]));
@@ -659,6 +687,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[40] += j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 243 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[392];
+#else
   if (T <= 1000.0) {
     Kc = (-7.8820827000000016e-01 + 8.4863500000000869e-03 * logT + T * (3.6284080700000021e-04 + T * (-4.9790876416666681e-07 + T * (3.0209506825000003e-10 + -7.1087114800000005e-14 * T))) - -1.4457907000000007e+04 / T);
   } else {
@@ -666,6 +697,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[243] - 2.0 * rev_rates[242]);
   kf = 19000000000.0;
   kr = kf / Kc;
@@ -886,6 +918,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[31] += j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 244 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[393];
+#else
   if (T <= 1000.0) {
     Kc = (1.5833454799999997e+00 + -6.9318238000000010e-01 * logT + T * (2.1750800220000002e-03 + T * (-1.7929999858333333e-06 + T * (9.1461468108333340e-10 + -1.9872614724999999e-13 * T))) - -5.3527955199999997e+04 / T);
   } else {
@@ -893,6 +928,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[244] - 2.0 * rev_rates[243]);
   kf = 29000000000.0;
   kr = kf / Kc;
@@ -1113,6 +1149,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[36] += -j_temp * 3.0006140000000002e+01;
 
   //partial of rxn 245 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[394];
+#else
   if (T <= 1000.0) {
     Kc = (8.8845551299999990e+00 + -2.2810372499999998e+00 * logT + T * (5.5434958095000007e-03 + T * (-2.6767883983333337e-06 + T * (8.4485374083333344e-10 + -1.1468647100000000e-13 * T))) - -3.6807024199999993e+04 / T);
   } else {
@@ -1120,6 +1159,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[245] - 2.0 * rev_rates[244]);
   kf = 41000000000.0;
   kr = kf / Kc;
@@ -1340,6 +1380,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 246 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[395];
+#else
   if (T <= 1000.0) {
     Kc = (7.1202864169999991e+00 + -2.3813621499999997e+00 * logT + T * (6.5601546298526678e-03 + T * (-2.9564407919993198e-06 + T * (9.1463821102506801e-10 + -1.3644229154638662e-13 * T))) - -4.0485779500000004e+04 / T);
   } else {
@@ -1347,6 +1390,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[246] - 2.0 * rev_rates[245]);
   kf = 16200000000.0;
   kr = kf / Kc;
@@ -1567,6 +1611,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[31] += j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 247 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[396];
+#else
   if (T <= 1000.0) {
     Kc = (4.2105307599999993e+00 + -9.8710710999999929e-01 * logT + T * (5.3560756950000012e-04 + T * (7.3798554166666652e-07 + T * (-5.9503726416666657e-10 + 1.4701011600000000e-13 * T))) - -2.0697714439999996e+04 / T);
   } else {
@@ -1574,6 +1621,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[247] - 2.0 * rev_rates[246]);
   kf = 24600000000.0;
   kr = kf / Kc;
@@ -1794,6 +1842,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[46] += j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 248 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[397];
+#else
   if (T <= 1000.0) {
     Kc = (1.1910938669999998e+00 + -4.4811549700000004e+00 * logT + T * (1.8350519288526665e-03 + T * (-2.3059867353326534e-06 + T * (1.0989205776917348e-09 + -2.2454970954638660e-13 * T))) - -3.0375003199999999e+04 / T);
   } else {
@@ -1807,8 +1858,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[248] - 2.0 * rev_rates[247]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[432];
+#else
   kf = exp(3.3367593413407739e+01 - 1.38 * logT - (6.3908884737113669e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2027,6 +2083,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 249 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[398];
+#else
   if (T <= 1000.0) {
     Kc = (6.6992891319999996e+00 + -1.7301509400000001e+00 * logT + T * (5.6599781685000008e-03 + T * (-3.7616241666666661e-06 + T * (1.6165218833333334e-09 + -3.0678911449999998e-13 * T))) - -3.7520949539999994e+04 / T);
   } else {
@@ -2034,8 +2093,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[249] - 2.0 * rev_rates[248]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[433];
+#else
   kf = exp(2.6393146759926932e+01 - 0.69 * logT - (3.8244686929296370e+02 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2254,6 +2318,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[44] = j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 250 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[399];
+#else
   if (T <= 1000.0) {
     Kc = (1.1910938669999998e+00 + -4.4811549700000004e+00 * logT + T * (1.8350519288526665e-03 + T * (-2.3059867353326534e-06 + T * (1.0989205776917348e-09 + -2.2454970954638660e-13 * T))) - -3.0375003199999999e+04 / T);
   } else {
@@ -2267,8 +2334,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[250] - 2.0 * rev_rates[249]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[434];
+#else
   kf = exp(2.4360851996672796e+01 - 0.36 * logT - (2.9186734761831440e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2487,6 +2559,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 251 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[400];
+#else
   if (T <= 1000.0) {
     Kc = (3.9586701239999997e+00 + -4.9170804099999996e+00 * logT + T * (3.5027950953526667e-03 + T * (-3.2123307003326528e-06 + T * (1.3353579343584013e-09 + -2.3733621854638666e-13 * T))) - -3.4867779399999999e+04 / T);
   } else {
@@ -2500,8 +2575,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[251] - 2.0 * rev_rates[250]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[432];
+#else
   kf = exp(3.3367593413407739e+01 - 1.38 * logT - (6.3908884737113669e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2720,6 +2800,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 252 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[401];
+#else
   if (T <= 1000.0) {
     Kc = (9.4668653889999987e+00 + -2.1660763800000002e+00 * logT + T * (7.3277213350000014e-03 + T * (-4.6679681316666663e-06 + T * (1.8529592400000001e-09 + -3.1957562350000003e-13 * T))) - -4.2013725739999994e+04 / T);
   } else {
@@ -2727,8 +2810,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[252] - 2.0 * rev_rates[251]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[433];
+#else
   kf = exp(2.6393146759926932e+01 - 0.69 * logT - (3.8244686929296370e+02 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2947,6 +3035,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[44] += j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 253 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[402];
+#else
   if (T <= 1000.0) {
     Kc = (3.9586701239999997e+00 + -4.9170804099999996e+00 * logT + T * (3.5027950953526667e-03 + T * (-3.2123307003326528e-06 + T * (1.3353579343584013e-09 + -2.3733621854638666e-13 * T))) - -3.4867779399999999e+04 / T);
   } else {
@@ -2960,8 +3051,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[253] - 2.0 * rev_rates[252]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[434];
+#else
   kf = exp(2.4360851996672796e+01 - 0.36 * logT - (2.9186734761831440e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3180,6 +3276,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 254 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[403];
+#else
   if (T <= 1000.0) {
     Kc = (5.6164365019999991e+00 + -1.4344375400000002e+00 * logT + T * (5.3213800750000007e-03 + T * (-3.9337669083333330e-06 + T * (1.7343073358333336e-09 + -3.2921794850000001e-13 * T))) - -4.1870715499999998e+04 / T);
   } else {
@@ -3187,8 +3286,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[254] - 2.0 * rev_rates[253]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[435];
+#else
   kf = exp(2.5287614028414247e+01 - (1.4492723467943888e+04 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3407,6 +3511,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 255 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[404];
+#else
   if (T <= 1000.0) {
     Kc = (6.0518051819999981e+00 + -1.0483902700000001e+00 * logT + T * (2.9609699150000002e-03 + T * (-1.8470270249999999e-06 + T * (8.9196369333333313e-10 + -2.1092152250000002e-13 * T))) - 5.9632787599999992e+03 / T);
   } else {
@@ -3414,8 +3521,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[255] - 2.0 * rev_rates[254]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[436];
+#else
   kf = exp(2.0723265836946410e+01 - (1.0945025535686789e+04 / T));
+#endif
   kr = kf / Kc;
   jac[95] +=  1.3906393237692718e+01 * (j_temp * 9.2803892982949643e-01);
   jac[89] +=  -1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3635,6 +3747,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 256 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[405];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0401329003000001e+01 + 2.6856239700000000e+00 * logT + T * (-5.9417067196473328e-03 + T * (1.5378137280006799e-06 + T * (4.5920593858401363e-11 + -1.1131002049638659e-13 * T))) - -7.3275569199999998e+04 / T);
   } else {
@@ -3642,6 +3757,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[256] - 3.0 * rev_rates[255]);
   kf = 22000000000.0;
   kr = kf / Kc;
@@ -3914,6 +4030,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[3] += -j_temp * 1.5999400000000000e+01;
 
   //partial of rxn 257 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[406];
+#else
   if (T <= 1000.0) {
     Kc = (-3.3153935599999991e+00 + 7.8487839999999931e-01 * logT + T * (-3.6345530800000001e-03 + T * (1.6437581733333331e-06 + T * (-4.3677168000000007e-10 + 4.5887614500000017e-14 * T))) - -5.8826987199999996e+04 / T);
   } else {
@@ -3921,6 +4040,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[257] - 2.0 * rev_rates[256]);
   kf = 2000000000.0;
   kr = kf / Kc;
@@ -4142,6 +4262,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 258 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[407];
+#else
   if (T <= 1000.0) {
     Kc = (-1.0318222020000000e+01 + 3.3813541800000007e+00 * logT + T * (-9.0394442999999994e-03 + T * (4.2381397583333326e-06 + T * (-1.3537671208333331e-09 + 1.9987518949999999e-13 * T))) - -2.1257116179999997e+04 / T);
   } else {
@@ -4149,6 +4272,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[258] - 3.0 * rev_rates[257]);
   kf = 12000000000.0;
   kr = kf / Kc;
@@ -4422,6 +4546,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 259 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[408];
+#else
   if (T <= 1000.0) {
     Kc = (-8.1774109749999990e+00 + 2.5035280100000006e+00 * logT + T * (-7.6974931996473331e-03 + T * (4.0025230313340135e-06 + T * (-1.3264417473082653e-09 + 1.8822288745361339e-13 * T))) - -2.9584739599999997e+04 / T);
   } else {
@@ -4429,6 +4556,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[259] - 3.0 * rev_rates[258]);
   kf = 12000000000.0;
   kr = kf / Kc;
@@ -4701,6 +4829,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   *J_nplusone = j_temp * 2.8013480000000001e+01;
 
   //partial of rxn 260 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[409];
+#else
   if (T <= 1000.0) {
     Kc = (-7.7533195670000001e+00 + 2.0370362700000002e+00 * logT + T * (-6.7917532288526653e-03 + T * (2.9413384019993197e-06 + T * (-8.6124471102506807e-10 + 1.2391504954638661e-13 * T))) - -3.4752503699999994e+04 / T);
   } else {
@@ -4708,6 +4839,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[260] - 2.0 * rev_rates[259]);
   kf = 100000000000.0;
   kr = kf / Kc;
@@ -4928,6 +5060,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 261 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[410];
+#else
   if (T <= 1000.0) {
     Kc = (7.0160316400000005e+00 + 1.6814149199999999e+00 * logT + T * (6.2878537950000002e-03 + T * (-2.5426125083333334e-06 + T * (9.2240838833333331e-10 + -1.6460279789999999e-13 * T))) - -3.5613599900000001e+04 / T);
   } else {
@@ -4941,8 +5076,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[261] - 2.0 * rev_rates[260]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[437];
+#else
   kf = exp(1.1492722757652709e+01 + 1.41 * logT - (4.2773663013028836e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[69] +=  2.1831557433974243e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5161,6 +5301,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 262 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[411];
+#else
   if (T <= 1000.0) {
     Kc = (-1.7384404499999992e+00 + 3.9447579699999995e+00 * logT + T * (-1.5003259699999999e-03 + T * (2.1411595616666667e-06 + T * (-8.4183515633333335e-10 + 1.2641865455000002e-13 * T))) - -3.1918048200000001e+04 / T);
   } else {
@@ -5174,8 +5317,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[262] - 2.0 * rev_rates[261]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[438];
+#else
   kf = exp(1.1918390573078392e+01 + 1.57 * logT - (2.2141660853803161e+04 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[99] +=  -2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5394,6 +5542,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[47] += j_temp * 4.2017139999999998e+01;
 
   //partial of rxn 263 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[412];
+#else
   if (T <= 1000.0) {
     Kc = (3.7439265520000000e+00 + 2.6506791299999999e+00 * logT + T * (4.8415850600000004e-03 + T * (-1.7352898250000000e-06 + T * (5.8738577583333326e-10 + -1.0399522550000000e-13 * T))) - -1.0824701640000001e+04 / T);
   } else {
@@ -5407,8 +5558,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[263] - 2.0 * rev_rates[262]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[439];
+#else
   kf = exp(7.6962126393464070e+00 + 2.11 * logT - (5.7367030393944551e+03 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5627,6 +5783,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 264 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[413];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4702867170000000e+00 + 4.2835363700000002e+00 * logT + T * (-1.3582460903526666e-03 + T * (1.3539415219993202e-06 + T * (-3.9204281819173466e-10 + 3.6982360096386612e-14 * T))) - -1.7931835899999998e+04 / T);
   } else {
@@ -5640,8 +5799,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[264] - 2.0 * rev_rates[263]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[440];
+#else
   kf = exp(1.0021270588192511e+01 + 1.7 * logT - (1.9122343464648184e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -5860,6 +6024,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[47] += j_temp * 4.2017139999999998e+01;
 
   //partial of rxn 265 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[414];
+#else
   if (T <= 1000.0) {
     Kc = (8.0088957710000006e+00 + 1.6712619200000001e+00 * logT + T * (8.3928447746473324e-03 + T * (-4.6441273996673469e-06 + T * (2.0799088164749320e-09 + -4.3537385545361338e-13 * T))) - -1.1709118073000000e+04 / T);
   } else {
@@ -5873,8 +6040,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[265] - 2.0 * rev_rates[264]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[441];
+#else
   kf = exp(4.6539603501575231e+00 + 2.5 * logT - (6.6928202126268643e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[46]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[46]);
@@ -6093,6 +6265,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[47] += j_temp * 4.2017139999999998e+01;
 
   //partial of rxn 266 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[415];
+#else
   if (T <= 1000.0) {
     Kc = (5.7718019200000006e+00 + 2.0335559300000003e+00 * logT + T * (4.5850261100000003e-03 + T * (-1.0806916166666668e-06 + T * (2.6623825916666662e-10 + -4.6174801500000004e-14 * T))) - -1.9226330260000002e+04 / T);
   } else {
@@ -6106,8 +6281,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[266] - 2.0 * rev_rates[265]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[442];
+#else
   kf = exp(1.0404262840448617e+01 + 1.5 * logT - (1.8115904334929860e+03 / T));
+#endif
   kr = kf / Kc;
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6326,6 +6506,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 267 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[416];
+#else
   if (T <= 1000.0) {
     Kc = (7.2943742080000007e+00 + 1.5687609899999999e+00 * logT + T * (4.6398878950000000e-03 + T * (-7.7244438333333316e-07 + T * (6.0733654166666666e-11 + 6.8128726000000001e-15 * T))) - -3.0101140260000000e+04 / T);
   } else {
@@ -6339,8 +6522,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[267] - 2.0 * rev_rates[266]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[443];
+#else
   kf = exp(8.1016777474545716e+00 + 1.5 * logT - (1.8115904334929860e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -6558,6 +6746,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[32] += j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 268 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[417];
+#else
   if (T <= 1478.0) {
     Kc = (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
   } else {
@@ -6571,9 +6762,14 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 1.2186597134166982e+01 * exp(Kc);
+#endif
   pres_mod_temp = (fwd_rates[268] - rev_rates[267]);
   j_temp = -mw_avg * rho_inv * pres_mod[35] * (2.0 * fwd_rates[268] - 3.0 * rev_rates[267]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[444];
+#else
   kf = exp(3.0099120647400166e+01 - (4.2632761534868267e+04 / T));
+#endif
   kr = kf / Kc;
   jac[99] +=  -2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[68] +=  1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6738,6 +6934,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[46] += j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 269 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[418];
+#else
   if (T <= 1382.0) {
     Kc = (-8.0860173100000008e+00 + -1.6472798900000001e+00 * logT + T * (-6.3752671000000000e-03 + T * (1.7465705999999998e-06 + T * (-3.6786069666666668e-10 + 3.7876073300000002e-14 * T))) - -1.9299025200000000e+04 / T);
   } else {
@@ -6751,8 +6950,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[269] - 2.0 * rev_rates[268]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[445];
+#else
   kf = exp(2.8372958460657927e+01 - 0.69 * logT - (1.4341757598486138e+03 / T));
+#endif
   kr = kf / Kc;
   jac[97] +=  -2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01);
   jac[99] +=  2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01);
@@ -6867,6 +7071,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 270 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[419];
+#else
   if (T <= 1000.0) {
     Kc = (5.5081952650000003e+00 + 2.7510040299999998e+00 * logT + T * (3.8249262396473334e-03 + T * (-1.4556374313340135e-06 + T * (5.1760130564159879e-10 + -8.2239404953613387e-14 * T))) - -7.1459463399999986e+03 / T);
   } else {
@@ -6880,8 +7087,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[270] - 2.0 * rev_rates[269]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[446];
+#else
   kf = exp(1.9413932516962650e+01 + 0.18 * logT - (1.0668254775014250e+03 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -7100,6 +7312,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 271 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[420];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4702867170000000e+00 + 4.2835363700000002e+00 * logT + T * (-1.3582460903526666e-03 + T * (1.3539415219993202e-06 + T * (-3.9204281819173466e-10 + 3.6982360096386612e-14 * T))) - -1.7931835899999998e+04 / T);
   } else {
@@ -7113,8 +7328,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[271] - 2.0 * rev_rates[270]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[447];
+#else
   kf = exp(2.5859064273996673e+01 - 0.75 * logT - (1.4543045424429804e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -7331,6 +7551,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[46] += j_temp * 4.3025080000000003e+01;
 
   //partial of rxn 272 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[421];
+#else
   if (T <= 1368.0) {
     Kc = (-1.8468721000000001e+00 + -2.7860495200000002e+00 * logT + T * (-3.4433396099999999e-03 + T * (5.3581310666666662e-07 + T * (-4.3099647250000000e-11 + -5.9680394000000003e-16 * T))) - 2.8269839999999999e+03 / T);
   } else {
@@ -7344,8 +7567,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[272] - 2.0 * rev_rates[271]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[448];
+#else
   kf = exp(9.9034875525361272e+00 + 2.0 * logT - (1.0064391297183255e+03 / T));
+#endif
   kr = kf / Kc;
   jac[98] +=  -2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01);
   jac[99] +=  2.1343075976744647e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7460,6 +7688,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[15] += j_temp * 2.8010399999999997e+01;
 
   //partial of rxn 273 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[422];
+#else
   if (T <= 1000.0) {
     Kc = (-8.3721898900000014e+00 + -1.8906642300000001e+00 * logT + T * (-6.8131993400000002e-03 + T * (2.2841488883333331e-06 + T * (-5.8605147633333348e-10 + 6.7923980050000029e-14 * T))) - -4.4248157999999996e+04 / T);
   } else {
@@ -7473,6 +7704,7 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[273] - 2.0 * rev_rates[272]);
   kf = 9000000000.0;
   kr = kf / Kc;
@@ -7693,6 +7925,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 274 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[423];
+#else
   if (T <= 1000.0) {
     Kc = (3.5695246169999995e+00 + -8.2192940000000014e-01 * logT + T * (1.8421406753526663e-03 + T * (-7.7651309366598670e-07 + T * (4.3738018769173463e-10 + -1.3894840754638661e-13 * T))) - -1.8438155900000005e+04 / T);
   } else {
@@ -7700,8 +7935,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[274] - 2.0 * rev_rates[273]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[449];
+#else
   kf = exp(2.7136724794113768e+01 - 0.31 * logT - (1.4593367380915720e+02 / T));
+#endif
   kr = kf / Kc;
   jac[95] +=  1.3906393237692718e+01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  -7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -7920,6 +8160,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[31] += -j_temp * 1.4006740000000001e+01;
 
   //partial of rxn 275 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[424];
+#else
   if (T <= 1000.0) {
     Kc = (5.3712497880000001e+00 + -1.5702706800000001e+00 * logT + T * (8.0103694999999996e-03 + T * (-6.4266887599999997e-06 + T * (3.0933943875000002e-09 + -6.4644388750000004e-13 * T))) - -5.8754937973000007e+04 / T);
   } else {
@@ -7927,8 +8170,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[275] - 2.0 * rev_rates[274]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[450];
+#else
   kf = exp(2.2031598656596589e+01 + 0.15 * logT - (-4.5289760837324650e+01 / T));
+#endif
   kr = kf / Kc;
   jac[94] +=  1.3406393237692720e+01 * (j_temp * 9.2803892982949643e-01 - kr * conc[40]);
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[40]);
@@ -8147,6 +8395,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[1] += j_temp * 2.0158800000000001e+00;
 
   //partial of rxn 276 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[425];
+#else
   if (T <= 1000.0) {
     Kc = (1.8509167610000001e+00 + -2.3769338000000007e-01 * logT + T * (5.2674526246473327e-03 + T * (-5.6816381996673469e-06 + T * (3.1128813914749324e-09 + -6.9979252545361348e-13 * T))) - 2.2360434270000023e+03 / T);
   } else {
@@ -8154,8 +8405,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[276] - 2.0 * rev_rates[275]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[451];
+#else
   kf = exp(6.2915691395583204e+00 + 2.4 * logT - (4.9894219855785987e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01 - kr * conc[32]);
   jac[87] =  -8.4482012818223300e+00 * (j_temp * 9.2803892982949643e-01 - kr * conc[32]);
@@ -8374,6 +8630,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 277 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[426];
+#else
   if (T <= 1000.0) {
     Kc = (-3.8617708999999945e-01 + 1.2460063000000021e-01 * logT + T * (1.4596339599999995e-03 + T * (-2.1182024166666672e-06 + T * (1.2992108341666668e-09 + -3.1059347150000004e-13 * T))) - -5.2811687599999968e+03 / T);
   } else {
@@ -8381,8 +8640,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[277] - 2.0 * rev_rates[276]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[452];
+#else
   kf = exp(1.0819778284410283e+01 + 1.6 * logT - (4.8057468444050045e+02 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[87] +=  -8.4482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
@@ -8601,6 +8865,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 278 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[427];
+#else
   if (T <= 1000.0) {
     Kc = (-2.4140524580000000e+00 + 7.4172382999999975e-01 * logT + T * (1.7161929099999997e-03 + T * (-2.7728006250000000e-06 + T * (1.6203583508333335e-09 + -3.6841389550000001e-13 * T))) - 3.1204598600000004e+03 / T);
   } else {
@@ -8608,8 +8875,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[278] - 2.0 * rev_rates[277]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[453];
+#else
   kf = exp(9.1484649682580947e+00 + 1.94 * logT - (3.2507983889901911e+03 / T));
+#endif
   kr = kf / Kc;
   jac[86] +=  7.9482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
   jac[87] +=  -8.4482012818223300e+00 * (j_temp * 9.2803892982949643e-01);
@@ -8828,6 +9100,9 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   jac[32] += -j_temp * 1.5014680000000000e+01;
 
   //partial of rxn 279 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[428];
+#else
   if (T <= 1000.0) {
     Kc = (-8.7544720899999984e+00 + 2.2633430500000000e+00 * logT + T * (-7.7881797650000001e-03 + T * (4.6837720699999996e-06 + T * (-1.7642435446666668e-09 + 2.9102145245000001e-13 * T))) - 3.6955517000000036e+03 / T);
   } else {
@@ -8835,8 +9110,13 @@ void eval_jacob_6 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[279] - 2.0 * rev_rates[278]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[454];
+#else
   kf = exp(2.3025850929940457e+01 - (7.2212007557289853e+03 / T));
+#endif
   kr = kf / Kc;
   jac[69] +=  -2.1831557433974243e+01 * (j_temp * 9.2803892982949643e-01);
   jac[68] +=  1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01);
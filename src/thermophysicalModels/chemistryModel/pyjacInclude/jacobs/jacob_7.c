@@ -1,9 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_7 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double m, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
   double conc_temp;
   double logT = log(T);
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double pres_mod_temp = 0.0;
@@ -23,6 +27,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[40] += -j_temp * 2.6017740000000000e+01;
 
   //partial of rxn 280 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[455];
+#else
   if (T <= 1000.0) {
     Kc = (2.0503790000000004e+00 + -5.1155920000000021e-01 * logT + T * (3.3535675350000000e-03 + T * (-2.6912835166666669e-06 + T * (1.3546791858333331e-09 + -2.9492676699999994e-13 * T))) - -3.0077857899999995e+04 / T);
   } else {
@@ -30,8 +37,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[280] - 2.0 * rev_rates[279]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[480];
+#else
   kf = exp(2.9449097893473976e+01 - 0.752 * logT - (1.7361074987641115e+02 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[90] +=  -2.2821566759926181e+01 * (j_temp * 9.2803892982949643e-01);
@@ -250,6 +262,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[16] += j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 281 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[456];
+#else
   if (T <= 1000.0) {
     Kc = (6.9536261999999995e+00 + -2.1570382800000001e+00 * logT + T * (6.5347924849999996e-03 + T * (-4.8443467149999997e-06 + T * (2.3179083683333331e-09 + -4.7890573240000005e-13 * T))) - -5.7209290200000003e+04 / T);
   } else {
@@ -257,8 +272,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[281] - 2.0 * rev_rates[280]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[481];
+#else
   kf = exp(2.1901920833288056e+01 - (-3.5476979322570975e+02 / T));
+#endif
   kr = kf / Kc;
   jac[90] +=  -2.2821566759926181e+01 * (j_temp * 9.2803892982949643e-01);
   jac[91] +=  2.1833085302696588e+01 * (j_temp * 9.2803892982949643e-01);
@@ -477,6 +497,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[16] += -j_temp * 4.4009799999999998e+01;
 
   //partial of rxn 282 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[457];
+#else
   if (T <= 1000.0) {
     Kc = (-1.1246941489999999e+01 + 2.9412362500000002e+00 * logT + T * (-7.1169632250000000e-03 + T * (3.1968998366666663e-06 + T * (-9.0735997799999998e-10 + 1.0214260245000000e-13 * T))) - -1.2232130300000004e+04 / T);
   } else {
@@ -484,8 +507,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[282] - 2.0 * rev_rates[281]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[482];
+#else
   kf = exp(2.1821878125614521e+01 - (5.6863810829085387e+03 / T));
+#endif
   kr = kf / Kc;
   jac[89] +=  1.4884884020874258e+01 * (j_temp * 9.2803892982949643e-01);
   jac[68] +=  1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -976,6 +1004,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[51] = j_temp * 4.3045220000000000e+01;
 
   //partial of rxn 284 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[458];
+#else
   if (T <= 1000.0) {
     Kc = (4.1807493069999992e+00 + -1.2184065799999999e+00 * logT + T * (1.0794207655352666e-02 + T * (-1.0308433526999320e-05 + T * (5.6773632118584010e-09 + -1.3116856005463866e-12 * T))) - -7.2168986300000015e+03 / T);
   } else {
@@ -983,8 +1014,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[284] - 2.0 * rev_rates[282]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[483];
+#else
   kf = exp(8.8098628053790566e+00 + 1.83 * logT - (1.1070830426901580e+02 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -1203,6 +1239,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[2] += j_temp * 1.0079400000000001e+00;
 
   //partial of rxn 285 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[459];
+#else
   if (T <= 1000.0) {
     Kc = (-2.8575363730000003e+00 + -2.4527328000000015e-01 * logT + T * (2.1363109803526664e-03 + T * (-1.4704039436659862e-06 + T * (7.1517632019173442e-10 + -1.6162240554638668e-13 * T))) - -3.8063103799999997e+04 / T);
   } else {
@@ -1210,6 +1249,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[285] - 2.0 * rev_rates[283]);
   kf = 109600000000.0;
   kr = kf / Kc;
@@ -1430,6 +1470,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 286 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[136];
+#else
   if (T <= 1000.0) {
     Kc = (-4.9137694999999981e-01 + -3.1271651999999950e-01 * logT + T * (1.0586348849999999e-03 + T * (-1.5680872316666664e-06 + T * (1.0823547516666667e-09 + -2.8203297000000007e-13 * T))) - -3.5267558860000005e+04 / T);
   } else {
@@ -1437,8 +1480,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[286] - 2.0 * rev_rates[284]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[484];
+#else
   kf = exp(2.9240459028362647e+01 - (8.7207950590092896e+03 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1658,7 +1706,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 287 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[287]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[485];
+#else
   kf = exp(1.5894952099644110e+01 + 0.5 * logT - (-8.8315033632783059e+02 / T));
+#endif
   jac[54] +=  (j_temp * 9.2803892982949643e-01);
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
@@ -1881,6 +1933,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 288 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[460];
+#else
   if (T <= 1000.0) {
     Kc = (9.9810038200000006e-01 + -1.1605573699999998e+00 * logT + T * (-3.1467022704999995e-03 + T * (4.4828933683333333e-06 + T * (-2.5158797433333334e-09 + 5.6630328100000000e-13 * T))) - -5.3434359426999989e+04 / T);
   } else {
@@ -1888,10 +1943,15 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[288] - rev_rates[285]);
   j_temp = -mw_avg * rho_inv * pres_mod[36] * (2.0 * fwd_rates[288] - rev_rates[285] + pres_mod_temp);
   pres_mod_temp *= exp(2.3920591315253070e+01 - 3.23 * logT - (4.8309078226479619e+02 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[486];
+#else
   kf = exp(2.1401299379696308e+01 + 0.43 * logT - (-1.8619123899789022e+02 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  -(j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[36] * (kf * conc[9]));
   jac[63] +=  -6.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp + pres_mod[36] * (kf * conc[9]));
@@ -2059,7 +2119,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 289 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[289]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[487];
+#else
   kf = exp(2.2481123754498785e+01 - (7.5482934728874409e+02 / T));
+#endif
   jac[55] +=  (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2277,6 +2341,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[4] += -j_temp * 3.1998799999999999e+01;
 
   //partial of rxn 290 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[461];
+#else
   if (T <= 1000.0) {
     Kc = (-2.9823164400000004e+00 + 4.1685521999999953e-01 * logT + T * (-5.5798952564999997e-03 + T * (5.2204773899999998e-06 + T * (-2.5436988100000001e-09 + 5.1793896750000006e-13 * T))) - -3.0126794040000001e+04 / T);
   } else {
@@ -2284,8 +2351,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[290] - 2.0 * rev_rates[286]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[488];
+#else
   kf = exp(2.1598734574300313e+01 - (7.5482934728874409e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2504,7 +2576,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 291 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[291]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[489];
+#else
   kf = exp(2.6021583203494448e+01 - (5.5298797982373399e+03 / T));
+#endif
   jac[55] +=  (j_temp * 9.2803892982949643e-01);
   jac[64] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01);
   jac[76] +=  1.2916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -2671,7 +2747,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 292 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[292]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[490];
+#else
   kf = exp(1.8037955122813692e+01 + 0.25 * logT - (-4.7051029314331714e+02 / T));
+#endif
   jac[54] +=  (j_temp * 9.2803892982949643e-01);
   jac[71] +=  1.4894874694922317e+01 * (j_temp * 9.2803892982949643e-01);
   jac[65] +=  -6.9581919558703875e+00 * (j_temp * 9.2803892982949643e-01);
@@ -2889,6 +2969,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 293 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[462];
+#else
   if (T <= 1000.0) {
     Kc = (-1.4039881000000154e-01 + -4.1759370999999978e-01 * logT + T * (4.4705988500000002e-03 + T * (-4.5389478750000000e-06 + T * (2.6800358791666669e-09 + -6.4893854799999999e-13 * T))) - -3.1521674399999974e+03 / T);
   } else {
@@ -2896,8 +2979,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[293] - 2.0 * rev_rates[287]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[491];
+#else
   kf = exp(1.9529243363473643e+01 + 0.29 * logT - (5.5354152134507899e+00 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3116,6 +3204,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[24] += -j_temp * 2.7045819999999999e+01;
 
   //partial of rxn 294 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[463];
+#else
   if (T <= 1000.0) {
     Kc = (7.3725952759999993e+00 + -1.8844437059999999e+00 * logT + T * (1.0047192465000000e-02 + T * (-8.3545226016666653e-06 + T * (4.0988278408333331e-09 + -8.5836470849999991e-13 * T))) - -7.0721144999999997e+03 / T);
   } else {
@@ -3123,8 +3214,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[294] - 2.0 * rev_rates[288]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[492];
+#else
   kf = exp(7.1981835771019433e+00 + 1.61 * logT - (-1.9323631290591851e+02 / T));
+#endif
   kr = kf / Kc;
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[76] +=  1.2916383911740777e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3343,6 +3439,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[51] += j_temp * 4.3045220000000000e+01;
 
   //partial of rxn 295 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[464];
+#else
   if (T <= 1000.0) {
     Kc = (3.7960643519999988e+00 + -4.9664917000000042e-01 * logT + T * (7.4049305600000000e-03 + T * (-7.9447590916666680e-06 + T * (4.3789134091666670e-09 + -9.9061360050000000e-13 * T))) - -2.4128240400000000e+03 / T);
   } else {
@@ -3350,8 +3449,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[295] - 2.0 * rev_rates[289]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[493];
+#else
   kf = exp(2.1794849453226600e+01 - (9.0982097326536621e+02 / T));
+#endif
   kr = kf / Kc;
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[105] +=  -2.1853066650792705e+01 * (j_temp * 9.2803892982949643e-01);
@@ -3572,7 +3676,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 296 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[296]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[493];
+#else
   kf = exp(2.1794849453226600e+01 - (9.0982097326536621e+02 / T));
+#endif
   jac[56] +=  -7.9366827390519274e+00 * (j_temp * 9.2803892982949643e-01);
   jac[58] +=  8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -3844,7 +3952,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 297 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[297]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[494];
+#else
   kf = exp(2.4127791008701241e+01 - (1.9701045964236222e+04 / T));
+#endif
   jac[57] +=  -1.5873365478103855e+01 * (j_temp * 9.2803892982949643e-01);
   jac[60] +=  1.6373365478103853e+01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4114,6 +4226,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[52] += -j_temp * 4.4053159999999998e+01;
 
   //partial of rxn 298 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[465];
+#else
   if (T <= 1000.0) {
     Kc = (8.0610335709999994e+00 + -1.4760663799999998e+00 * logT + T * (1.0956190274647334e-02 + T * (-1.0853596666334014e-05 + T * (5.8714364498082656e-09 + -1.3219922304536135e-12 * T))) - -3.2972404730000017e+03 / T);
   } else {
@@ -4121,8 +4236,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[298] - 2.0 * rev_rates[290]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[495];
+#else
   kf = exp(1.4533350351114590e+01 + 1.16 * logT - (1.2102430534862865e+03 / T));
+#endif
   kr = kf / Kc;
   jac[54] +=  (j_temp * 9.2803892982949643e-01 - kr * conc[50]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[50]);
@@ -4343,7 +4463,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 299 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[299]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[495];
+#else
   kf = exp(1.4533350351114590e+01 + 1.16 * logT - (1.2102430534862865e+03 / T));
+#endif
   jac[54] +=  (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4615,7 +4739,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 300 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[300]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[496];
+#else
   kf = exp(1.6969527810483978e+01 + 0.73 * logT - (-5.6008337568824811e+02 / T));
+#endif
   jac[58] +=  -8.4366827390519266e+00 * (j_temp * 9.2803892982949643e-01);
   jac[59] +=  8.9366827390519283e+00 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -4887,7 +5015,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 301 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[301]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[497];
+#else
   kf = exp(2.1825205915707194e+01 - (5.9998868718157973e+03 / T));
+#endif
   jac[60] +=  -1.6373365478103853e+01 * (j_temp * 9.2803892982949643e-01);
   jac[61] +=  1.6873365478103853e+01 * (j_temp * 9.2803892982949643e-01);
   jac[66] +=  7.4581919558703884e+00 * (j_temp * 9.2803892982949643e-01);
@@ -5157,7 +5289,11 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
 
   //partial of rxn 302 wrt species
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[302]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[498];
+#else
   kf = exp(7.9083871592900428e+00 + 1.77 * logT - (2.9790598239662436e+03 / T));
+#endif
   jac[105] +=  -2.1853066650792705e+01 * (j_temp * 9.2803892982949643e-01);
   jac[67] +=  7.9581919558703893e+00 * (j_temp * 9.2803892982949643e-01);
   jac[68] +=  1.3894874694922315e+01 * (j_temp * 9.2803892982949643e-01);
@@ -5327,6 +5463,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[29] += -j_temp * 4.2037279999999996e+01;
 
   //partial of rxn 303 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[466];
+#else
   if (T <= 1000.0) {
     Kc = (-9.8390084700000102e-01 + -2.2677429999999976e-01 * logT + T * (-3.6901490503526658e-03 + T * (3.2143732336659863e-06 + T * (-1.3752132235250679e-09 + 2.4409805754638663e-13 * T))) - -1.6909265259999996e+04 / T);
   } else {
@@ -5334,10 +5473,15 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[303] - rev_rates[291]);
   j_temp = -mw_avg * rho_inv * pres_mod[37] * (2.0 * fwd_rates[303] - rev_rates[291] + pres_mod_temp);
   pres_mod_temp *= exp(6.2902244459060583e+01 - 8.052 * logT - (2.8225585392950438e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[499];
+#else
   kf = exp(2.0002747459590335e+01 + 0.422 * logT - (-8.8315033632783059e+02 / T));
+#endif
   kr = kf / Kc;
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[104] +=  2.1353066650792705e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -6267,6 +6411,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[13] += j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 307 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[467];
+#else
   if (T <= 1000.0) {
     Kc = (-6.0983846269999997e+00 + 1.9857142400000005e+00 * logT + T * (-5.9857737853526664e-03 + T * (2.9364451936659867e-06 + T * (-1.0855833793584013e-09 + 2.0070804954638662e-13 * T))) - -6.7105727399999960e+03 / T);
   } else {
@@ -6274,6 +6421,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[307] - 2.0 * rev_rates[292]);
   kf = 22000000000.0;
   kr = kf / Kc;
@@ -6494,6 +6642,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[29] += j_temp * 4.2037279999999996e+01;
 
   //partial of rxn 308 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[468];
+#else
   if (T <= 1000.0) {
     Kc = (5.2159456710000018e+00 + -1.4288945800000001e+00 * logT + T * (7.6804094246473321e-03 + T * (-6.4607317330006798e-06 + T * (3.0549806731415985e-09 + -6.1290393795361344e-13 * T))) - -3.4955989712999995e+04 / T);
   } else {
@@ -6501,6 +6652,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[308] - 2.0 * rev_rates[293]);
   kf = 11000000000.0;
   kr = kf / Kc;
@@ -6721,6 +6873,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 309 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[469];
+#else
   if (T <= 1000.0) {
     Kc = (2.9788518200000009e+00 + -1.0666005699999994e+00 * logT + T * (3.8725907599999991e-03 + T * (-2.8972959499999993e-06 + T * (1.2413101158333333e-09 + -2.2370488400000000e-13 * T))) - -4.2473201900000000e+04 / T);
   } else {
@@ -6728,6 +6883,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[309] - 2.0 * rev_rates[294]);
   kf = 12000000000.0;
   kr = kf / Kc;
@@ -6948,6 +7104,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[5] += -j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 310 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[470];
+#else
   if (T <= 1000.0) {
     Kc = (-1.2709672719999983e+00 + 6.8399759000000060e-01 * logT + T * (-2.9922293800000001e-03 + T * (2.2005386833333331e-06 + T * (-1.0606578475000001e-09 + 2.2379308650000000e-13 * T))) - -4.4909058699999996e+03 / T);
   } else {
@@ -6955,6 +7114,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[310] - 2.0 * rev_rates[295]);
   kf = 30100000000.0;
   kr = kf / Kc;
@@ -7179,6 +7339,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[50] = j_temp * 4.4096519999999998e+01;
 
   //partial of rxn 311 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[471];
+#else
   if (T <= 1000.0) {
     Kc = (1.9936419700000002e+01 + -6.0465022699999995e+00 * logT + T * (1.4300108085000001e-02 + T * (-8.2230877600000006e-06 + T * (3.7338613208333330e-09 + -8.0399162200000022e-13 * T))) - -4.3245145300000004e+04 / T);
   } else {
@@ -7186,6 +7349,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[311] - rev_rates[296]);
   j_temp = -mw_avg * rho_inv * pres_mod[38] * (2.0 * fwd_rates[311] - rev_rates[296] + pres_mod_temp);
   pres_mod_temp *= exp(1.3460557302489494e+02 - 16.82 * logT - (6.5745636148849617e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
@@ -7356,6 +7520,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[5] += j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 312 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[472];
+#else
   if (T <= 1000.0) {
     Kc = (-1.1767372380000007e+00 + 9.4174631999999958e-01 * logT + T * (2.2270116000000051e-04 + T * (-9.5850737499999998e-07 + T * (3.8457190916666643e-10 + -4.4511165499999962e-14 * T))) - -9.1679563999999891e+02 / T);
   } else {
@@ -7363,8 +7530,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[312] - 2.0 * rev_rates[297]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[500];
+#else
   kf = exp(5.2626901889048856e+00 + 2.68 * logT - (1.8699639030166488e+03 / T));
+#endif
   kr = kf / Kc;
   jac[102] =  2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[103] +=  -2.1874575867611163e+01 * (j_temp * 9.2803892982949643e-01);
@@ -7583,6 +7755,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[50] += -j_temp * 4.4096519999999998e+01;
 
   //partial of rxn 313 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[473];
+#else
   if (T <= 1000.0) {
     Kc = (3.0882319809999963e+00 + -3.7670890000000012e-02 * logT + T * (3.7739608746473353e-03 + T * (-3.8673449496673465e-06 + T * (1.8770949498082650e-09 + -3.7588979545361337e-13 * T))) - -1.8012120729999988e+03 / T);
   } else {
@@ -7590,8 +7765,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[313] - 2.0 * rev_rates[298]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[501];
+#else
   kf = exp(7.1853870155804165e+00 + 2.54 * logT - (3.3997513801885034e+03 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01 - kr * conc[48]);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01 - kr * conc[48]);
@@ -7810,6 +7990,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[6] += j_temp * 1.8015280000000001e+01;
 
   //partial of rxn 314 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[474];
+#else
   if (T <= 1000.0) {
     Kc = (8.5113812999999983e-01 + 3.2462312000000004e-01 * logT + T * (-3.3857789999999430e-05 + T * (-3.0390916666666656e-07 + T * (6.3424392499999843e-11 + 1.3309258500000038e-14 * T))) - -9.3184242599999961e+03 / T);
   } else {
@@ -7817,8 +8000,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[314] - 2.0 * rev_rates[299]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[502];
+#else
   kf = exp(1.0360912399575003e+01 + 1.8 * logT - (4.7000707357845801e+02 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[103] +=  -2.1874575867611163e+01 * (j_temp * 9.2803892982949643e-01);
@@ -8037,6 +8225,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[8] += -j_temp * 3.4014679999999998e+01;
 
   //partial of rxn 315 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[475];
+#else
   if (T <= 1000.0) {
     Kc = (-1.5469436199999995e+00 + -9.2312670000000097e-02 * logT + T * (-1.8868495465000005e-03 + T * (1.3584396166666659e-06 + T * (-4.2226984166666672e-10 + 4.0469295500000020e-14 * T))) - -6.5929928600000021e+03 / T);
   } else {
@@ -8044,8 +8235,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[315] - 2.0 * rev_rates[300]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[503];
+#else
   kf = exp(-9.7286108336254939e-01 + 2.72 * logT - (7.5482934728874409e+02 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  -2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[103] +=  2.1874575867611163e+01 * (j_temp * 9.2803892982949643e-01);
@@ -8264,6 +8460,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[14] += j_temp * 1.6042760000000001e+01;
 
   //partial of rxn 316 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[476];
+#else
   if (T <= 1000.0) {
     Kc = (-5.9192838099999996e+00 + 1.5942837200000000e+00 * logT + T * (-8.0572647749999997e-03 + T * (6.6206537733333336e-06 + T * (-3.2695998625000005e-09 + 6.9919299800000005e-13 * T))) - -2.1012633999999998e+03 / T);
   } else {
@@ -8271,8 +8470,13 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[316] - 2.0 * rev_rates[301]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[504];
+#else
   kf = exp(-7.0097880045472882e+00 + 3.65 * logT - (3.6000327670024503e+03 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[103] +=  -2.1874575867611163e+01 * (j_temp * 9.2803892982949643e-01);
@@ -8495,6 +8699,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 317 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[477];
+#else
   if (T <= 1000.0) {
     Kc = (2.2001903790000000e+01 + -5.5812400800000006e+00 * logT + T * (1.5775775360000001e-02 + T * (-1.0074865626666667e-05 + T * (4.7017067124999990e-09 + -1.0079523820000001e-12 * T))) - -1.0902911730000002e+04 / T);
   } else {
@@ -8502,10 +8709,15 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[317] - rev_rates[302]);
   j_temp = -mw_avg * rho_inv * pres_mod[39] * (2.0 * fwd_rates[317] - rev_rates[302] + pres_mod_temp);
   pres_mod_temp *= exp(1.2450211395117624e+02 - 16.2 * logT - (6.2751479737937589e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[505];
+#else
   kf = exp(7.8438486381524717e+00 + 1.6 * logT - (2.8683515196972276e+03 / T));
+#endif
   kr = kf / Kc;
   jac[78] +=  -1.3916383911740775e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
   jac[102] +=  2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01 + 1.9280389298294964e+00 * pres_mod_temp);
@@ -8672,6 +8884,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[18] += j_temp * 3.0026280000000000e+01;
 
   //partial of rxn 318 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[478];
+#else
   if (T <= 1000.0) {
     Kc = (-2.2744840250000003e+01 + 4.8803699299999996e+00 * logT + T * (-1.8403791885000000e-02 + T * (1.3002193923333333e-05 + T * (-6.0086292883333325e-09 + 1.2371129445000000e-12 * T))) - -4.1221452400000002e+04 / T);
   } else {
@@ -8679,6 +8894,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[318] - 2.0 * rev_rates[303]);
   kf = 96400000000.0;
   kr = kf / Kc;
@@ -8903,6 +9119,9 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   jac[50] += j_temp * 4.4096519999999998e+01;
 
   //partial of rxn 319 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[479];
+#else
   if (T <= 1000.0) {
     Kc = (1.1438128429999992e+00 + -1.6179979899999999e+00 * logT + T * (2.1629949964733358e-04 + T * (6.2098645033265328e-07 + T * (-1.9732750019173448e-10 + 7.0839150463866008e-15 * T))) - -5.0064042900000000e+04 / T);
   } else {
@@ -8910,6 +9129,7 @@ void eval_jacob_7 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = 8.2057360967184814e-02 * exp(Kc);
+#endif
   pres_mod_temp = ((1.0 / (1.0 + Pr)) - log(fmax(Fcent, 1.0e-300)) * 2.0 * A * (B * 0.4342944819032518 + A * 0.06080122746645526) / (B * B * B * (1.0 + A * A / (B * B)) * (1.0 + A * A / (B * B)))) * (fwd_rates[319] - rev_rates[304]);
   j_temp = -mw_avg * rho_inv * pres_mod[40] * (2.0 * fwd_rates[319] - rev_rates[304] + pres_mod_temp);
   pres_mod_temp *= exp(1.0381793042865615e+02 - 13.545 * logT - (5.7150645981055113e+03 / T)) * pow(Fcent, 1.0 / (1 + A * A / (B * B))) / (1.0 + Pr);
@@ -1,8 +1,13 @@
 #include <math.h>
 #include "header.h"
+#include "rate_table.h"
 
 void eval_jacob_8 (const double pres, const double * __restrict__ conc, const double * __restrict__ fwd_rates, const double * __restrict__ rev_rates, const double * __restrict__ pres_mod, const double * __restrict__ spec_rates, const double mw_avg, const double rho, const double * __restrict__ dBdT, const double T, double * __restrict__ jac) {
+#ifdef PYJAC_RATE_TABLE
+  const double * __restrict__ rt = rate_table_eval(T);
+#else
   double logT = log(T);
+#endif
   double kf = 0.0;
   double j_temp = 0.0;
   double Kc = 0.0;
@@ -16,6 +21,9 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   jac[26] += j_temp * 2.9061699999999998e+01;
 
   //partial of rxn 320 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[506];
+#else
   if (T <= 1000.0) {
     Kc = (-1.8792606857000003e+01 + 4.4285042800000003e+00 * logT + T * (-1.4083808585352667e-02 + T * (8.8440742103326544e-06 + T * (-3.9311888210250679e-09 + 8.1107553704638672e-13 * T))) - -6.8188975999999948e+03 / T);
   } else {
@@ -23,8 +31,13 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[320] - 2.0 * rev_rates[305]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[510];
+#else
   kf = exp(8.3089382525957785e+00 + 2.19 * logT - (4.4786541272465485e+02 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  -2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[55] +=  -5.0000000000000000e-01 * (j_temp * 9.2803892982949643e-01);
@@ -243,6 +256,9 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   jac[5] += -j_temp * 1.7007339999999999e+01;
 
   //partial of rxn 321 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[507];
+#else
   if (T <= 1000.0) {
     Kc = (-1.3965189502000001e+01 + 3.1267876299999995e+00 * logT + T * (-1.1090264180000000e-02 + T * (8.1081677000000007e-06 + T * (-3.9062632891666661e-09 + 8.3416057400000011e-13 * T))) - -4.5992307299999993e+03 / T);
   } else {
@@ -250,6 +266,7 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[321] - 2.0 * rev_rates[306]);
   kf = 24100000000.0;
   kr = kf / Kc;
@@ -470,6 +487,9 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   jac[7] += -j_temp * 3.3006740000000001e+01;
 
   //partial of rxn 322 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[508];
+#else
   if (T <= 1000.0) {
     Kc = (-1.3425150799999996e+00 + -6.3733963999999954e-01 * logT + T * (1.0924926749999993e-03 + T * (-1.2641780649999996e-06 + T * (1.0189303591666671e-09 + -2.9534222850000009e-13 * T))) - -2.5949134600000001e+04 / T);
   } else {
@@ -477,8 +497,13 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[322] - 2.0 * rev_rates[307]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[511];
+#else
   kf = exp(1.7054189010128656e+01 + 0.255 * logT - (-4.7453604966219046e+02 / T));
+#endif
   kr = kf / Kc;
   jac[102] +=  -2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[103] +=  2.1874575867611163e+01 * (j_temp * 9.2803892982949643e-01);
@@ -968,6 +993,9 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   jac[13] += -j_temp * 1.5034820000000000e+01;
 
   //partial of rxn 324 wrt species
+#ifdef PYJAC_RATE_TABLE
+  Kc = rt[509];
+#else
   if (T <= 1000.0) {
     Kc = (-1.7200494010000000e+01 + 3.8877891599999987e+00 * logT + T * (-1.8188054794999998e-02 + T * (1.5219714806666666e-05 + T * (-7.7787148291666661e-09 + 1.7092348230000002e-12 * T))) - -1.3936088000000000e+03 / T);
   } else {
@@ -975,8 +1003,13 @@ void eval_jacob_8 (const double pres, const double * __restrict__ conc, const do
   }
 
   Kc = exp(Kc);
+#endif
   j_temp = -mw_avg * rho_inv * (2.0 * fwd_rates[324] - 2.0 * rev_rates[308]);
+#ifdef PYJAC_RATE_TABLE
+  kf = rt[512];
+#else
   kf = exp(2.3681815319372685e+01 - 0.32 * logT);
+#endif
   kr = kf / Kc;
   jac[102] +=  -2.1374575867611167e+01 * (j_temp * 9.2803892982949643e-01);
   jac[79] +=  2.8832767823481554e+01 * (j_temp * 9.2803892982949643e-01);
@@ -0,0 +1,134 @@
+#include <math.h>
+#include <string.h>
+#include "header.h"
+#include "rate_table.h"
+
+static int rt_nT = 0;
+static int rt_generation = 0;
+static double rt_T_low = 0.0;
+static double rt_dT = 0.0;
+
+// constants and derivatives, node-major
+static double * rt_k = NULL;
+static double * rt_dkdT = NULL;
+
+int rate_table_init (const double T_low, const double T_high, const int n_T) {
+  rate_table_free();
+
+  if (n_T < 2 || T_high <= T_low) {
+    return 1;
+  }
+
+  rt_k = (double *) malloc((size_t)n_T * N_RATE_CONST * sizeof(double));
+  rt_dkdT = (double *) malloc((size_t)n_T * N_RATE_CONST * sizeof(double));
+
+  if (rt_k == NULL || rt_dkdT == NULL) {
+    rate_table_free();
+    return 1;
+  }
+
+  const double dT = (T_high - T_low) / (n_T - 1);
+  double k_plus[N_RATE_CONST];
+  double k_minus[N_RATE_CONST];
+
+  for (int n = 0; n < n_T; ++n) {
+    const double T = T_low + n * dT;
+    const double h = 1.0e-5 * T;
+    double * __restrict__ k = &rt_k[(size_t)n * N_RATE_CONST];
+    double * __restrict__ dkdT = &rt_dkdT[(size_t)n * N_RATE_CONST];
+
+    eval_rate_constants(T, k);
+    eval_rate_constants(T + h, k_plus);
+    eval_rate_constants(T - h, k_minus);
+
+    for (int i = 0; i < N_RATE_CONST; ++i) {
+      dkdT[i] = (k_plus[i] - k_minus[i]) / (2.0 * h);
+    }
+  }
+
+  rt_T_low = T_low;
+  rt_dT = dT;
+  rt_nT = n_T;
+  ++rt_generation;
+
+  return 0;
+} // end rate_table_init
+
+void rate_table_free (void) {
+  free(rt_k);
+  free(rt_dkdT);
+  rt_k = NULL;
+  rt_dkdT = NULL;
+  rt_nT = 0;
+  ++rt_generation;
+} // end rate_table_free
+
+void rate_table_interp (const double T, double * __restrict__ k, double * __restrict__ dkdT) {
+  // Test for no table and for x outside the table before converting x to
+  // int, which is undefined for NaN and out-of-range values
+  const double x = rt_nT == 0 ? -1.0 : (T - rt_T_low) / rt_dT;
+
+  if (!(x >= 0.0) || x >= rt_nT - 1) {
+    eval_rate_constants(T, k);
+
+    if (dkdT != NULL) {
+      const double h = 1.0e-5 * T;
+      double k_plus[N_RATE_CONST];
+      double k_minus[N_RATE_CONST];
+
+      eval_rate_constants(T + h, k_plus);
+      eval_rate_constants(T - h, k_minus);
+
+      for (int i = 0; i < N_RATE_CONST; ++i) {
+        dkdT[i] = (k_plus[i] - k_minus[i]) / (2.0 * h);
+      }
+    }
+
+    return;
+  }
+
+  // Hermite basis on the interval [n, n + 1]
+  const int n = (int) x;
+  const double t = x - n;
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+  const double h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+  const double h10 = (t3 - 2.0 * t2 + t) * rt_dT;
+  const double h01 = -2.0 * t3 + 3.0 * t2;
+  const double h11 = (t3 - t2) * rt_dT;
+
+  const double * __restrict__ k0 = &rt_k[(size_t)n * N_RATE_CONST];
+  const double * __restrict__ k1 = k0 + N_RATE_CONST;
+  const double * __restrict__ d0 = &rt_dkdT[(size_t)n * N_RATE_CONST];
+  const double * __restrict__ d1 = d0 + N_RATE_CONST;
+
+  for (int i = 0; i < N_RATE_CONST; ++i) {
+    k[i] = h00 * k0[i] + h10 * d0[i] + h01 * k1[i] + h11 * d1[i];
+  }
+
+  if (dkdT != NULL) {
+    const double g00 = (6.0 * t2 - 6.0 * t) / rt_dT;
+    const double g10 = 3.0 * t2 - 4.0 * t + 1.0;
+    const double g01 = -g00;
+    const double g11 = 3.0 * t2 - 2.0 * t;
+
+    for (int i = 0; i < N_RATE_CONST; ++i) {
+      dkdT[i] = g00 * k0[i] + g10 * d0[i] + g01 * k1[i] + g11 * d1[i];
+    }
+  }
+} // end rate_table_interp
+
+const double * rate_table_eval (const double T) {
+  static _Thread_local int cache_generation = -1;
+  static _Thread_local double cache_T = -1.0;
+  static _Thread_local double cache_k[N_RATE_CONST];
+
+  if (T != cache_T || cache_generation != rt_generation) {
+    rate_table_interp(T, cache_k, NULL);
+    cache_T = T;
+    cache_generation = rt_generation;
+  }
+
+  return cache_k;
+} // end rate_table_eval
+
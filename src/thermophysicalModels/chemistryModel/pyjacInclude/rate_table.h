@@ -0,0 +1,42 @@
+#ifndef RATE_TABLE_HEAD
+#define RATE_TABLE_HEAD
+
+#include "header.h"
+#include "rate_table_size.h"
+
+/**
+ * Table of the temperature-only rate constants of the Jacobian: the
+ * Arrhenius forward rate constants kf and the equilibrium constants Kc,
+ * as collected by tabulateRates.py.
+ *
+ * The constants and their temperature derivatives are stored at nT uniformly
+ * spaced temperatures, node-major, and interpolated by cubic Hermite
+ * polynomials.  Outside the table, or before rate_table_init, the
+ * expressions are evaluated exactly.  The jacob_*.c read the table when
+ * compiled with -DPYJAC_RATE_TABLE.
+ *
+ * With 1 K spacing the constants are within a relative 5e-5 of the
+ * expressions above 600 K, limited by the switch of the NASA polynomials,
+ * and within 3e-3 at 300 K where the steepest Arrhenius terms vary fastest.
+ */
+
+/** Exact evaluation of the N_RATE_CONST constants at T, generated */
+void eval_rate_constants (const double, double * __restrict__);
+
+/** Build the table over [T_low, T_high] with n_T temperatures, 0 on success */
+int rate_table_init (const double, const double, const int);
+
+/** Release the table */
+void rate_table_free (void);
+
+/** Constants and, if dkdT is not NULL, their derivatives at T */
+void rate_table_interp (const double, double * __restrict__, double * __restrict__);
+
+/**
+ * Constants at T in thread-local storage, interpolated only if T differs
+ * from the previous call of the thread; the eval_jacob_* of one Jacobian
+ * share a single interpolation
+ */
+const double * rate_table_eval (const double);
+
+#endif
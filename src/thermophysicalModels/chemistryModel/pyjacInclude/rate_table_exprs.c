@@ -0,0 +1,2690 @@
+#include <math.h>
+#include "header.h"
+#include "rate_table.h"
+
+/** Generated by tabulateRates.py from the jacobs/jacob_*.c */
+void eval_rate_constants (const double T, double * __restrict__ k) {
+  double logT = log(T);
+  double Kc = 0.0;
+
+  if (T <= 1000.0) {
+    Kc = (2.1078866500000002e+00 + -1.5540778400000002e+00 * logT + T * (1.7809517600000000e-03 + T * (-5.7313765166666677e-07 + T * (2.1456978249999992e-10 + -4.9079552499999993e-14 * T))) - -5.9308461960000001e+04 / T);
+  } else {
+    Kc = (-2.2591422699999990e+00 + -8.5630372000000055e-01 * logT + T * (8.2751788369999995e-04 + T * (-1.4031059780000000e-07 + T * (1.9125509566666665e-11 + -1.2064226609999998e-15 * T))) - -5.9523615919999997e+04 / T);
+  }
+
+  k[0] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.2924395000000217e-02 + -6.7625167000000008e-01 * logT + T * (4.3900065964733344e-04 + T * (-3.3752092466734670e-07 + T * (1.8724440897493195e-10 + -3.7427250453613386e-14 * T))) - -5.0980838539999997e+04 / T);
+  } else {
+    Kc = (2.1155734940000004e+00 + -9.7653312000000003e-01 * logT + T * (3.1720192639214862e-04 + T * (1.4092792157300865e-08 + T * (-6.4940309137373039e-12 + 5.2564500959013211e-16 * T))) - -5.0832582000000002e+04 / T);
+  }
+
+  k[1] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.2649692190000001e+00 + 9.7941720999999982e-01 * logT + T * (-3.5512597146473328e-03 + T * (2.9088375746673469e-06 + T * (-1.4925230406415989e-09 + 3.3137862995361342e-13 * T))) - 8.8441643299999987e+02 / T);
+  } else {
+    Kc = (2.7645101560000001e+00 + -3.1381229999999993e-01 * logT + T * (3.4190313985785133e-04 + T * (-6.9149998790634198e-08 + T * (8.4698344637373041e-12 + -4.7563182059013212e-16 * T))) - 1.0648967219999986e+03 / T);
+  }
+
+  k[2] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.5192523180000004e+00 + 3.0440668000000004e-01 * logT + T * (1.3151938349999998e-03 + T * (-2.2226854399999996e-06 + T * (1.4035022683333334e-09 + -3.3985339400000004e-13 * T))) - -2.6865930240000002e+04 / T);
+  } else {
+    Kc = (1.5716927700000003e+00 + -2.1120617000000053e-01 * logT + T * (-6.1164380150000074e-05 + T * (-6.6252916499999993e-09 + T * (1.4413174416666625e-12 + -1.8401260499999993e-17 * T))) - -2.6559236532999999e+04 / T);
+  }
+
+  k[3] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.7236808580000003e+00 + 8.4943364999999993e-01 * logT + T * (-1.6641483864999998e-03 + T * (3.9993224166666590e-07 + T * (-3.7697932500000234e-11 + -4.0418699999999293e-15 * T))) - -7.5097885000000024e+03 / T);
+  } else {
+    Kc = (1.8562804999999960e-01 + 3.7567494000000057e-01 * logT + T * (-1.0170464901500000e-03 + T * (2.2538181151666665e-07 + T * (-2.7905665974999994e-11 + 1.4256438845000000e-15 * T))) - -7.3852776869999980e+03 / T);
+  }
+
+  k[4] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.9566783299999972e-01 + -5.7855027999999953e-01 * logT + T * (1.1725648098526663e-03 + T * (-6.5620983033265317e-07 + T * (3.2274157135840136e-10 + -8.0549676996386610e-14 * T))) - -8.8789978699999992e+04 / T);
+  } else {
+    Kc = (-2.6646139340000001e+00 + -2.3269989000000058e-01 * logT + T * (5.8879391980785141e-04 + T * (-1.9753664479063422e-07 + T * (3.0896552680403970e-11 + -1.9600523155901322e-15 * T))) - -8.8908228000000003e+04 / T);
+  }
+
+  k[5] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.5701580300000000e-01 + -2.0975992999999971e-01 * logT + T * (-4.6673931114733357e-04 + T * (7.2366370466734677e-07 + T * (-2.7795262730826530e-10 + 2.6880587453613394e-14 * T))) - -4.5813074439999997e+04 / T);
+  } else {
+    Kc = (-1.4325223539999996e+00 + -1.7134752000000031e-01 * logT + T * (6.9326821530785111e-04 + T * (-1.8624310045730086e-07 + T * (2.8250000347070641e-11 + -1.7903225405901325e-15 * T))) - -4.5995605049999998e+04 / T);
+  }
+
+  k[6] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.3516116449999993e+00 + -1.4430066199999998e+00 * logT + T * (6.5080500499999994e-03 + T * (-5.5562271383333331e-06 + T * (2.8233701111666665e-09 + -6.1681745944999994e-13 * T))) - -9.4881096672999993e+04 / T);
+  } else {
+    Kc = (-9.9881815299999985e+00 + 1.1910056099999995e+00 * logT + T * (-1.2783936496999998e-03 + T * (2.4510033634999999e-07 + T * (-2.9783467175000002e-11 + 1.6202032794999998e-15 * T))) - -9.5245610121999984e+04 / T);
+  }
+
+  k[7] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.3105604539999995e+00 + -6.4568536999999937e-01 * logT + T * (1.2010038553526665e-03 + T * (-1.8268026033265306e-07 + T * (-4.1515270641598609e-11 + 1.4094078453613389e-14 * T))) - -5.0305850640000004e+04 / T);
+  } else {
+    Kc = (-4.4698935139999989e+00 + 4.1071518999999990e-01 * logT + T * (1.9352149030785106e-04 + T * (-8.5747517123967536e-08 + T * (1.5106129430403969e-11 + -1.0303785505901323e-15 * T))) - -5.0658000749999999e+04 / T);
+  }
+
+  k[8] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.9522333929999998e+00 + 4.5186564999999979e-01 * logT + T * (-4.3199832996473333e-03 + T * (4.1581197130006792e-06 + T * (-2.0774404673082654e-09 + 4.2603740745361341e-13 * T))) - -3.4402554800000005e+04 / T);
+  } else {
+    Kc = (5.3967806600000046e-01 + -5.9444841000000026e-01 * logT + T * (1.0230372703078513e-03 + T * (-2.4623218212396754e-07 + T * (3.5062104263737296e-11 + -2.1449230505901326e-15 * T))) - -3.4515335800000001e+04 / T);
+  }
+
+  k[9] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.7425465719999984e+00 + -6.5253739999999993e-01 * logT + T * (8.2799659349999995e-03 + T * (-7.5791611483333340e-06 + T * (3.6541717716666670e-09 + -7.4370416350000000e-13 * T))) - 1.1844677600000014e+03 / T);
+  } else {
+    Kc = (-1.2999221864999999e+01 + 2.7343331150000001e+00 * logT + T * (-2.7583212501499999e-03 + T * (4.7171189651666662e-07 + T * (-5.8764090141666656e-11 + 3.2806345645000000e-15 * T))) - 8.8500678999999946e+02 / T);
+  }
+
+  k[10] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.7317365300000009e+00 + -3.3910270499999999e+00 * logT + T * (6.4371346450000002e-03 + T * (-2.4639068299999998e-06 + T * (6.4002088133333328e-10 + -6.7596737949999993e-14 * T))) - -6.3150142900000006e+04 / T);
+  } else {
+    Kc = (-8.9042421999999988e+00 + -4.2714609999999986e-01 * logT + T * (1.2189084718499997e-03 + T * (-2.0965612131666668e-07 + T * (2.5287913325000004e-11 + -1.4035990855000001e-15 * T))) - -6.3824872699999993e+04 / T);
+  }
+
+  k[11] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.2239180279999999e+00 + 1.8209595999999983e-01 * logT + T * (1.7557864800000003e-03 + T * (-2.4647093033333336e-06 + T * (1.3723623411666664e-09 + -2.9953290794999994e-13 * T))) - -4.3690829600000005e+04 / T);
+  } else {
+    Kc = (-2.7537778599999987e+00 + 4.6647811999999966e-01 * logT + T * (-1.1300120001499997e-03 + T * (2.6169785468333337e-07 + T * (-3.6419762141666668e-11 + 2.1749500094999998e-15 * T))) - -4.3522712650000001e+04 / T);
+  }
+
+  k[12] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.5407428970000012e+00 + -2.5326794200000005e+00 * logT + T * (7.7539204653526671e-03 + T * (-4.5910952086659860e-06 + T * (1.8251388135250679e-09 + -3.2970239544638660e-13 * T))) - -5.5860133960000006e+04 / T);
+  } else {
+    Kc = (-1.3773593554000000e+01 + 1.0158651399999998e+00 * logT + T * (-2.2830545469214878e-04 + T * (3.7948941209365808e-08 + T * (-4.6378179029293633e-12 + 2.4570591440986790e-16 * T))) - -5.6515003349999999e+04 / T);
+  }
+
+  k[13] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.8448959199999955e-01 + 2.5121102000000040e-01 * logT + T * (3.7712048449999999e-03 + T * (-4.2611969583333330e-06 + T * (2.2384208091666663e-09 + -4.7940607800000004e-13 * T))) - -7.3586569799999979e+03 / T);
+  } else {
+    Kc = (-5.7005718099999996e+00 + 1.5349511899999999e+00 * logT + T * (-1.8043208651500001e-03 + T * (3.3711479484999995e-07 + T * (-4.1264893141666657e-11 + 2.2773796795000002e-15 * T))) - -7.3511716499999993e+03 / T);
+  }
+
+  k[14] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.7796507480000017e+00 + 1.7535822999999997e+00 * logT + T * (-7.3135277050000004e-03 + T * (4.8940262233333329e-06 + T * (-2.1023659991666664e-09 + 4.0295237050000001e-13 * T))) - -3.6622221669999999e+04 / T);
+  } else {
+    Kc = (8.9467570300000006e+00 + -1.4085087199999999e+00 * logT + T * (5.9431833984999953e-04 + T * (-9.7836693483333268e-08 + T * (1.1770759024999988e-11 + -6.5086216050000005e-16 * T))) - -3.6112248130000000e+04 / T);
+  }
+
+  k[15] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.8216490497999999e+01 + 3.5112674799999999e+00 * logT + T * (-8.1234636850000003e-03 + T * (4.9930672083333330e-06 + T * (-2.3586630991666664e-09 + 5.1765550950000007e-13 * T))) - -4.0794736440000001e+04 / T);
+  } else {
+    Kc = (1.1905747490000001e+01 + -1.4866420300000001e+00 * logT + T * (9.8145382485000012e-04 + T * (-2.8027456014999993e-07 + T * (4.4503387024999995e-11 + -2.8373251655000005e-15 * T))) - -3.9482586920000002e+04 / T);
+  }
+
+  k[16] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.8490200520000011e+00 + -1.0277583099999998e+00 * logT + T * (1.0852818630000000e-02 + T * (-1.0222753856666668e-05 + T * (5.2395350508333331e-09 + -1.1257071015000000e-12 * T))) - -3.0583267100000035e+03 / T);
+  } else {
+    Kc = (-1.1425997359999998e+01 + 2.4264246700000003e+00 * logT + T * (-2.4068287001499994e-03 + T * (4.4975898651666659e-07 + T * (-5.6033715808333333e-11 + 3.1358850294999993e-15 * T))) - -3.2265536700000002e+03 / T);
+  }
+
+  k[17] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5285859802000001e+01 + -2.7854434900000009e+00 * logT + T * (1.1662754609999999e-02 + T * (-1.0321794841666669e-05 + T * (5.4958321508333335e-09 + -1.2404102404999998e-12 * T))) - 1.1141880599999981e+03 / T);
+  } else {
+    Kc = (-1.4384987819999997e+01 + 2.5045579799999995e+00 * logT + T * (-2.7939641851499998e-03 + T * (6.3219685318333327e-07 + T * (-8.8766343808333338e-11 + 5.3223480345000000e-15 * T))) - 1.4378512000000137e+02 / T);
+  }
+
+  k[18] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.6939031699999996e+00 + 1.0114256899999998e+00 * logT + T * (-5.2085801994999998e-03 + T * (3.5269516366666668e-06 + T * (-1.6068215921666669e-09 + 3.2549881104999994e-13 * T))) - -3.9508445000000007e+04 / T);
+  } else {
+    Kc = (2.0270112800000004e+00 + -1.4357696000000031e-01 * logT + T * (-8.1640189764999992e-04 + T * (1.5692369918333330e-07 + T * (-1.6233942758333332e-11 + 6.8690533949999985e-16 * T))) - -3.9478080099999999e+04 / T);
+  }
+
+  k[19] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.7226776189999988e+00 + 7.7477320600000010e-01 * logT + T * (-1.2136115296473345e-03 + T * (8.5750275633401398e-07 + T * (-3.8428487147493192e-10 + 6.6079446453613315e-14 * T))) - -1.0018131000000001e+04 / T);
+  } else {
+    Kc = (-9.3422152339999975e+00 + 1.4112153899999988e+00 * logT + T * (-8.9517622469214870e-04 + T * (1.2292422954269918e-07 + T * (-1.4261156319596031e-11 + 7.7436764440986798e-16 * T))) - -1.0352703399999999e+04 / T);
+  }
+
+  k[20] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.2777324203999999e+01 + 2.9047245659999996e+00 * logT + T * (-4.5368002400000005e-03 + T * (8.3585097499999963e-07 + T * (3.0923280916666690e-10 + -1.5904831849999996e-13 * T))) - 1.4903233860000008e+04 / T);
+  } else {
+    Kc = (8.0148296500000011e+00 + -4.5629623000000041e-01 * logT + T * (-2.8752189514999991e-04 + T * (1.0327241985000004e-07 + T * (-2.0095857891666669e-11 + 1.4456572495000000e-15 * T))) - 1.5826143700000008e+04 / T);
+  }
+
+  k[21] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4285961375999999e+01 + 3.3652639459999998e+00 * logT + T * (-9.8618627985000012e-03 + T * (5.4476383800000000e-06 + T * (-2.0692569255000003e-09 + 3.5855313605000001e-13 * T))) - -2.3891285800000001e+04 / T);
+  } else {
+    Kc = (1.1563527210000000e+01 + -1.1277036800000007e+00 * logT + T * (-7.8386088150000054e-05 + T * (-1.2795279983333316e-08 + T * (2.7365138249999950e-12 + -2.1211719550000005e-16 * T))) - -2.3041846699999998e+04 / T);
+  }
+
+  k[22] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.9513886870000006e+00 + -1.7448972500000002e+00 * logT + T * (9.9416996603526649e-03 + T * (-8.3264587603326529e-06 + T * (4.2698188851917346e-09 + -9.4211615804638651e-13 * T))) - -4.5551364140000005e+04 / T);
+  } else {
+    Kc = (-1.3811250679000000e+01 + 1.4251525499999995e+00 * logT + T * (-6.2032882969214904e-04 + T * (7.8246449542699077e-08 + T * (-7.0224352362626955e-12 + 2.7742737940986808e-16 * T))) - -4.5907846210000003e+04 / T);
+  }
+
+  k[23] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.9176353200000000e+00 + 7.6730766000000061e-01 * logT + T * (4.8084338700000000e-03 + T * (-7.3719883333333327e-06 + T * (4.5917798324999999e-09 + -1.1109775509999999e-12 * T))) - -1.3927471369999999e+04 / T);
+  } else {
+    Kc = (2.7363486099999990e+00 + 4.5236016000000001e-01 * logT + T * (-1.1812926781500001e-03 + T * (1.9953851351666670e-07 + T * (-2.3113752341666680e-11 + 1.2205706795000001e-15 * T))) - -1.3369962790000001e+04 / T);
+  }
+
+  k[24] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.5443462400000003e+00 + 9.9258077000000000e-01 * logT + T * (-2.1573708999999934e-04 + T * (-2.2175208833333329e-06 + T * (1.7700855408333336e-09 + -4.7212187849999997e-13 * T))) - -3.9827843600000000e+04 / T);
+  } else {
+    Kc = (4.3672912500000018e+00 + -4.7766940000000013e-01 * logT + T * (-4.3569844815000060e-04 + T * (8.8397768516666832e-08 + T * (-1.1671862174999997e-11 + 6.6561178449999852e-16 * T))) - -3.9295347099999999e+04 / T);
+  }
+
+  k[25] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.5426192799999976e-01 + 8.3878908999999968e-01 * logT + T * (1.0964775499999995e-03 + T * (-2.0424456083333341e-06 + T * (1.0984084008333341e-09 + -2.2831108549999995e-13 * T))) - -1.1433466400000002e+03 / T);
+  } else {
+    Kc = (-3.3670607500000007e+00 + 1.4062418100000000e+00 * logT + T * (-1.8267958351499995e-03 + T * (3.5468279818333343e-07 + T * (-4.4989291308333320e-11 + 2.5437107344999998e-15 * T))) - -1.0750088999999980e+03 / T);
+  }
+
+  k[26] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.2211293192999999e+01 + 3.2390784399999997e+00 * logT + T * (-7.7982047596473333e-03 + T * (3.1866109496673467e-06 + T * (-7.7780674914159882e-10 + 5.7248619553613431e-14 * T))) - -5.2396220300000001e+04 / T);
+  } else {
+    Kc = (1.4603868736000001e+01 + -1.2672553500000010e+00 * logT + T * (6.2844425307851271e-05 + T * (-7.4357547457300893e-08 + T * (1.5321939263737300e-11 + -1.1275023805901323e-15 * T))) - -5.1374879000000001e+04 / T);
+  }
+
+  k[27] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.8207233480000005e+00 + 9.3963343000000021e-01 * logT + T * (2.0707511000000035e-04 + T * (-1.3932465250000002e-06 + T * (8.4822635250000012e-10 + -1.9002249800000002e-13 * T))) - 1.5951883999999995e+03 / T);
+  } else {
+    Kc = (-6.5105246149999996e+00 + 1.6403753700000001e+00 * logT + T * (-2.1419267601499995e-03 + T * (4.4341640318333330e-07 + T * (-5.9584478141666664e-11 + 3.5294444395000002e-15 * T))) - 1.5193460100000011e+03 / T);
+  }
+
+  k[28] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.6193461800000000e+00 + 8.1534879000000027e-01 * logT + T * (-2.4430421734999994e-03 + T * (1.0705031933333333e-06 + T * (-3.8396922916666677e-10 + 7.2281704100000002e-14 * T))) - -2.4447270760000003e+04 / T);
+  } else {
+    Kc = (3.3754021349999994e+00 + -3.4915667999999966e-01 * logT + T * (-4.2343007815000017e-04 + T * (8.3947980183333279e-08 + T * (-1.0804863758333336e-11 + 6.1371550449999990e-16 * T))) - -2.4162087989999996e+04 / T);
+  }
+
+  k[29] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.6238498799999999e+00 + -1.8369492099999998e+00 * logT + T * (4.6561828850000004e-03 + T * (-1.8907691783333333e-06 + T * (4.2545109883333335e-10 + -1.8517185450000006e-14 * T))) - -3.8416809400000056e+03 / T);
+  } else {
+    Kc = (-6.6450999300000007e+00 + 4.2915762000000068e-01 * logT + T * (3.9139058814999976e-04 + T * (-6.9345523516666680e-08 + T * (6.1624037583333416e-12 + -1.9717642450000027e-16 * T))) - -4.3012567799999961e+03 / T);
+  }
+
+  k[30] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.9037419099999999e+00 + -5.3195659999999645e-02 * logT + T * (2.4560110100000001e-03 + T * (-2.0385115183333330e-06 + T * (8.3491854083333272e-10 + -1.3955268399999999e-13 * T))) - 1.9507273260000002e+04 / T);
+  } else {
+    Kc = (-7.2722645800000008e+00 + 1.7461573600000004e+00 * logT + T * (-1.7431564850000001e-03 + T * (3.4374008649999992e-07 + T * (-4.2706210583333316e-11 + 2.2957809400000006e-15 * T))) - 1.9208064882999999e+04 / T);
+  }
+
+  k[31] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.4863279230000002e+00 + -9.8065834999999968e-01 * logT + T * (-8.7619317535266635e-04 + T * (1.8851645153326530e-06 + T * (-1.2162578593584016e-09 + 3.0242614354638670e-13 * T))) - -2.4114908299999999e+04 / T);
+  } else {
+    Kc = (5.4388072400000009e-01 + -7.6532694999999951e-01 * logT + T * (3.7836630654214864e-04 + T * (2.0718083807300866e-08 + T * (-7.9353483554039681e-12 + 5.4404627009013201e-16 * T))) - -2.4273345466999999e+04 / T);
+  }
+
+  k[32] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.1408110450000004e+00 + 8.7782617000000007e-01 * logT + T * (-1.3419511003526666e-03 + T * (2.3561672699932007e-07 + T * (-2.7325373525067973e-11 + 1.1652302046386607e-14 * T))) - 8.3276234200000017e+03 / T);
+  } else {
+    Kc = (4.3747157639999994e+00 + -1.2022939999999949e-01 * logT + T * (-5.1031595730785127e-04 + T * (1.5440338995730085e-07 + T * (-2.5619540480403969e-11 + 1.7320676705901320e-15 * T))) - 8.6910339200000017e+03 / T);
+  }
+
+  k[33] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.2320448239999999e+00 + -1.6556688799999999e+00 * logT + T * (3.9902603742946671e-03 + T * (-3.2463584993346931e-06 + T * (1.6797674496165307e-09 + -3.6880588040722682e-13 * T))) - -5.1865254972999996e+04 / T);
+  } else {
+    Kc = (-6.4893666199999966e-01 + -6.6272082000000010e-01 * logT + T * (-2.4701213465702698e-05 + T * (8.3242790947935064e-08 + T * (-1.4963865377474610e-11 + 1.0012768301802643e-15 * T))) - -5.1897478722000000e+04 / T);
+  }
+
+  k[34] = 8.2057360967184814e-02 * exp(Kc);
+
+  k[35] = exp(2.5510757579728459e+01 - 1.0 * logT);
+  k[36] = exp(2.6937873935368604e+01 - 1.0 * logT);
+  k[37] = exp(3.6558396000357360e+00 + 2.7 * logT - (3.1501544760183588e+03 / T));
+  k[38] = exp(9.1726385047921717e+00 + 2.0 * logT - (2.0128782594366510e+03 / T));
+  k[39] = exp(1.3835313185260453e+01 + 1.5 * logT - (4.3276882577888000e+03 / T));
+  k[40] = exp(1.6705882315860439e+01 - (1.2001786621891031e+03 / T));
+  k[41] = exp(2.4386827483076058e+01 - (1.7813972596014362e+03 / T));
+  k[42] = exp(5.9610053396232736e+00 + 2.5 * logT - (1.5599806510634046e+03 / T));
+  k[43] = exp(4.8675344504555822e+00 + 2.5 * logT - (2.5160978242958136e+03 / T));
+  k[44] = exp(9.5104449644265205e+00 + 2.0 * logT - (9.5611717323240919e+02 / T));
+  k[45] = exp(3.8367417791399781e+01 - 1.41 * logT - (1.4568206402672762e+04 / T));
+  k[46] = exp(8.8450570535008506e+00 + 2.0 * logT - (9.5611717323240919e+02 / T));
+  k[47] = exp(9.4334839232903924e+00 + 1.83 * logT - (1.1070830426901580e+02 / T));
+  k[48] = exp(1.1405340254290291e+01 + 1.92 * logT - (2.8633193240486362e+03 / T));
+  k[49] = exp(2.3025850929940457e+01 - (4.0257565188733020e+03 / T));
+  k[50] = exp(2.1282881624881835e+01 - (6.7934641255986969e+02 / T));
+  k[51] = exp(2.1639556568820566e+01 - (2.4053895200267980e+04 / T));
+  k[52] = exp(2.5328436022934504e+01 - (2.0128782594366508e+04 / T));
+  k[53] = exp(2.8660640533109706e+01 - 0.86 * logT);
+  k[54] = exp(3.0665974102635822e+01 - 1.24 * logT);
+  k[55] = exp(3.0052277738640093e+01 - 0.76 * logT);
+  k[56] = exp(3.0889117653950031e+01 - 1.24 * logT);
+  k[57] = exp(2.7274346171989816e+01 - 0.8 * logT);
+  k[58] = exp(3.0908165848920724e+01 - 0.6707 * logT - (8.5753646047649927e+03 / T));
+  k[59] = exp(2.7631021115928547e+01 - 1.0 * logT);
+  k[60] = exp(2.5223075507276675e+01 - 0.6 * logT);
+  if (T <= 1000.0) {
+    Kc = (1.9949509729999999e+00 + -1.2933748700000001e+00 * logT + T * (1.8244170964733350e-04 + T * (3.1707728366598661e-07 + T * (-1.3390310769173469e-10 + 2.0393173546386613e-14 * T))) - -5.9382467160000000e+04 / T);
+  } else {
+    Kc = (3.4956521039999999e+00 + -1.5588951899999999e+00 * logT + T * (8.1424417354214874e-04 + T * (-4.8429627026032460e-08 + T * (-7.5798555540397048e-13 + 2.5394305509013217e-16 * T))) - -5.9336614000000001e+04 / T);
+  }
+
+  k[61] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.6321879950000002e+00 + 5.6510965000000057e-01 * logT + T * (-2.8331621535266673e-04 + T * (-1.3324705046673464e-06 + T * (1.0550293781415989e-09 + -2.7038066795361348e-13 * T))) - -2.6939935439999997e+04 / T);
+  } else {
+    Kc = (7.3264871439999988e+00 + -9.1379763999999986e-01 * logT + T * (-7.4438090307851279e-05 + T * (8.5255679123967526e-08 + T * (-1.8442177680403972e-11 + 1.4419644555901321e-15 * T))) - -2.6372234613000001e+04 / T);
+  }
+
+  k[62] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.7457169009999998e+00 + -6.7501052999999978e-01 * logT + T * (4.8664535496473326e-03 + T * (-5.1315230146673465e-06 + T * (2.8960253089749321e-09 + -6.7123202395361341e-13 * T))) - -2.7750346673000000e+04 / T);
+  } else {
+    Kc = (-1.1928173859999998e+00 + 1.0260612999999941e-01 * logT + T * (-4.0306752000785135e-04 + T * (6.2524707140634199e-08 + T * (-7.0285170220706416e-12 + 4.5723056009013213e-16 * T))) - -2.7624133254999997e+04 / T);
+  }
+
+  k[63] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.6600633630000008e+00 + 1.1822328500000001e+00 * logT + T * (-2.6757265352666572e-05 + T * (-1.9870687130006796e-06 + T * (1.3761768948082653e-09 + -3.2820109195361345e-13 * T))) - -1.8538306819999998e+04 / T);
+  } else {
+    Kc = (5.9464085339999997e+00 + -3.3143557000000001e-01 * logT + T * (-5.7148033745785135e-04 + T * (1.4777809830730085e-07 + T * (-2.4178223038737304e-11 + 1.7136664100901320e-15 * T))) - -1.7868202613000001e+04 / T);
+  }
+
+  k[64] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5412883609999999e+00 + -1.2998355999999989e-01 * logT + T * (1.8871113281473330e-03 + T * (-2.5089053330006806e-06 + T * (1.4548251081415985e-09 + -3.3542049995361335e-13 * T))) - -8.3942049330000009e+03 / T);
+  } else {
+    Kc = (-2.5788821060000005e+00 + 6.8948724000000050e-01 * logT + T * (-1.3589496300078514e-03 + T * (2.9453181030730083e-07 + T * (-3.6375500438737303e-11 + 1.9012757050901321e-15 * T))) - -8.4501744089999956e+03 / T);
+  }
+
+  k[65] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.3558688530000005e+00 + 1.4145433000000001e+00 * logT + T * (-1.9474646018526665e-03 + T * (-9.3253826300068034e-07 + T * (1.0173314456415985e-09 + -2.7442253795361340e-13 * T))) - -3.4449723939999996e+04 / T);
+  } else {
+    Kc = (7.5121151939999979e+00 + -5.3812269999999929e-01 * logT + T * (-1.0914845804578513e-03 + T * (3.1063749064063419e-07 + T * (-4.6347843655403966e-11 + 2.8676083400901325e-15 * T))) - -3.3757512300000002e+04 / T);
+  }
+
+  k[66] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.6682364710000002e+00 + -1.0912459799999996e+00 * logT + T * (3.6675737421473331e-03 + T * (-2.8425613505006798e-06 + T * (1.3552334365582654e-09 + -2.8517527465361342e-13 * T))) - -1.1745005272999997e+04 / T);
+  } else {
+    Kc = (-3.8932999959999997e+00 + 4.5148333999999979e-01 * logT + T * (-4.8616360130785134e-04 + T * (4.7096267473967532e-08 + T * (-9.5411978040397240e-13 + -1.2275900640986782e-16 * T))) - -1.1984959922000007e+04 / T);
+  }
+
+  k[67] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.0778036030000000e+00 + -1.5890882699999995e+00 * logT + T * (5.2103980314733363e-04 + T * (4.8922002533265336e-07 + T * (-2.5168856019173461e-10 + 4.2822007546386620e-14 * T))) - -5.5032701199999996e+04 / T);
+  } else {
+    Kc = (5.8439448840000008e+00 + -2.0883834200000000e+00 * logT + T * (1.7917537365421488e-03 + T * (-2.6303292102603245e-07 + T * (2.7958758311262697e-11 + -1.3971341599098680e-15 * T))) - -5.4961679599999989e+04 / T);
+  }
+
+  k[68] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.8472794779999990e+00 + -8.6445633999999982e-01 * logT + T * (5.3354852401473326e-03 + T * (-4.9000173080006804e-06 + T * (2.5006285398082657e-09 + -5.3626778245361345e-13 * T))) - -6.0911179730000003e+03 / T);
+  } else {
+    Kc = (-7.3235675959999984e+00 + 1.4237055000000001e+00 * logT + T * (-1.8671875695078517e-03 + T * (4.4263698114063416e-07 + T * (-6.0680019855403972e-11 + 3.5802555950901316e-15 * T))) - -6.3373821219999954e+03 / T);
+  }
+
+  k[69] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.7754709669999986e+00 + -2.3714270000000148e-02 * logT + T * (-7.8409652753526661e-03 + T * (7.2416402236659866e-06 + T * (-3.4669273626917350e-09 + 7.0627691304638665e-13 * T))) - -5.2165306299999997e+04 / T);
+  } else {
+    Kc = (1.5114795359000000e+01 + -3.7108662350000001e+00 * logT + T * (3.0755231765421487e-03 + T * (-4.5761910435936572e-07 + T * (5.2270059227929359e-11 + -2.7549895549098682e-15 * T))) - -5.1717588790000002e+04 / T);
+  }
+
+  k[70] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.0075157909999994e+00 + -1.6319546099999998e+00 * logT + T * (1.1831225649647333e-02 + T * (-1.0487998723000679e-05 + T * (5.1466948123082656e-09 + -1.0750827934536134e-12 * T))) - 3.0005132700000104e+02 / T);
+  } else {
+    Kc = (-1.5763732020999999e+01 + 3.0481454150000000e+00 * logT + T * (-3.1002243900078515e-03 + T * (5.4086189530730083e-07 + T * (-6.7233924605403965e-11 + 3.7562663850901325e-15 * T))) - -1.7988993199999823e+02 / T);
+  }
+
+  k[71] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.1741398699999976e-01 + -9.2746269000000048e-01 * logT + T * (-3.3322041853526664e-03 + T * (3.9236760336659856e-06 + T * (-2.0511764001917343e-09 + 4.4197882754638664e-13 * T))) - -4.3622181559999997e+04 / T);
+  } else {
+    Kc = (7.8161453040000008e+00 + -2.5114843100000002e+00 * logT + T * (2.1215227915421489e-03 + T * (-3.2302200269269910e-07 + T * (3.4770862227929353e-11 + -1.7517346699098684e-15 * T))) - -4.3481410349999998e+04 / T);
+  }
+
+  k[72] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.0410511910000002e+00 + -7.9732125000000043e-01 * logT + T * (5.3070461946473331e-03 + T * (-5.3735468780006796e-06 + T * (2.8648853818082653e-09 + -6.3091153790361341e-13 * T))) - -4.4575246033000003e+04 / T);
+  } else {
+    Kc = (-5.5182880160000005e+00 + 7.8029041999999960e-01 * logT + T * (-1.4719151400078509e-03 + T * (3.3084785347396747e-07 + T * (-4.4889596605403977e-11 + 2.6505818300901323e-15 * T))) - -4.4587609371999999e+04 / T);
+  }
+
+  k[73] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.7467263529999997e+00 + -2.4298339699999998e+00 * logT + T * (7.7525283646473339e-03 + T * (-5.2315471480006795e-06 + T * (2.2896104081415984e-09 + -4.4037962095361341e-13 * T))) - -1.4358616870000000e+04 / T);
+  } else {
+    Kc = (-6.8311835360000011e+00 + 4.3197560000000013e-01 * logT + T * (-2.7711641345785128e-04 + T * (1.1192948564063416e-07 + T * (-1.8264789938737294e-11 + 1.1765071700901325e-15 * T))) - -1.4720333869999997e+04 / T);
+  }
+
+  k[74] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.8183566103000000e+01 + -4.1875191500000000e+00 * logT + T * (8.5624643446473338e-03 + T * (-5.3305881330006796e-06 + T * (2.5459075081415984e-09 + -5.5508275995361342e-13 * T))) - -1.0186102099999998e+04 / T);
+  } else {
+    Kc = (-9.7901739960000000e+00 + 5.1010890999999980e-01 * logT + T * (-6.6425189845785177e-04 + T * (2.9436735230730079e-07 + T * (-5.0997417938737298e-11 + 3.3629701750901327e-15 * T))) - -1.1349995079999999e+04 / T);
+  }
+
+  k[75] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.6494588109999997e+00 + -7.2820618999999942e-01 * logT + T * (7.3224645596473327e-03 + T * (-7.1700345330006799e-06 + T * (3.7309438498082653e-09 + -8.1078470795361340e-13 * T))) - -8.2430734129999983e+03 / T);
+  } else {
+    Kc = (-8.4650819659999996e+00 + 1.8487634899999998e+00 * logT + T * (-2.1462240050078513e-03 + T * (4.0626479364063411e-07 + T * (-4.9734727605403966e-11 + 2.7530115000901327e-15 * T))) - -8.4160683719999979e+03 / T);
+  }
+
+  k[76] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.8819444470000004e+00 + 3.5150664000000020e-01 * logT + T * (-1.0413817970352667e-02 + T * (9.8852329319993209e-06 + T * (-5.0522906418584007e-09 + 1.0882798510463865e-12 * T))) - -4.7922511829999996e+04 / T);
+  } else {
+    Kc = (1.3541570854000000e+01 + -3.4029577900000003e+00 * logT + T * (2.7240306265421477e-03 + T * (-4.3566619435936569e-07 + T * (4.9539684894596029e-11 + -2.6102400199098675e-15 * T))) - -4.7606028330000001e+04 / T);
+  }
+
+  k[77] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.5146815290000006e+00 + 7.7416508999999989e-01 * logT + T * (-3.7622679903526672e-03 + T * (1.9851886486659860e-06 + T * (-6.0984295852506789e-10 + 7.1573740546386646e-14 * T))) - -3.7506638103000005e+04 / T);
+  } else {
+    Kc = (6.1822468740000014e+00 + -1.0946964200000002e+00 * logT + T * (2.5241519999214847e-04 + T * (-2.8686694692699044e-08 + T * (3.3009245612626810e-12 + -1.7523033990986813e-16 * T))) - -3.7177144851999998e+04 / T);
+  }
+
+  k[78] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.8274173550000006e+00 + 1.3017166499999999e+00 * logT + T * (-2.9935444053526663e-03 + T * (7.3590651033265337e-07 + T * (-2.4925531858401327e-11 + -2.3085036953613373e-14 * T))) - -2.2196668699999973e+03 / T);
+  } else {
+    Kc = (8.4070789640000001e+00 + -8.1406030999999990e-01 * logT + T * (-4.2871893045785207e-04 + T * (1.4839548864063428e-07 + T * (-2.3291345238737306e-11 + 1.4940608900901324e-15 * T))) - -1.5969123300000028e+03 / T);
+  }
+
+  k[79] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.6778462419999993e+00 + 2.0333554899999999e+00 * logT + T * (-4.9998856653526661e-03 + T * (1.4701077336659865e-06 + T * (-1.4357743602506805e-10 + -3.2727361953613374e-14 * T))) - -2.0766566299999977e+03 / T);
+  } else {
+    Kc = (9.0961573439999999e+00 + -8.6663478999999999e-01 * logT + T * (-9.0648176845785204e-04 + T * (2.6250319930730094e-07 + T * (-3.8864218188737303e-11 + 2.3851941150901325e-15 * T))) - -1.3094510300000002e+03 / T);
+  }
+
+  k[80] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.5318784196999999e+01 + 2.1091918200000004e+00 * logT + T * (-1.1223753950352668e-02 + T * (9.9842739169993203e-06 + T * (-5.3085877418584011e-09 + 1.2029829900463866e-12 * T))) - -5.2095026599999997e+04 / T);
+  } else {
+    Kc = (1.6500561313999999e+01 + -3.4810910999999995e+00 * logT + T * (3.1111661115421482e-03 + T * (-6.1810406102603236e-07 + T * (8.2272312894596034e-11 + -4.7967030249098682e-15 * T))) - -5.0976367119999995e+04 / T);
+  }
+
+  k[81] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.4368397500000007e+00 + 1.7576851800000002e+00 * logT + T * (-8.0993597999999990e-04 + T * (9.9040985000000045e-08 + T * (-2.5629710000000004e-10 + 1.1470313900000000e-13 * T))) - -4.1725147699999998e+03 / T);
+  } else {
+    Kc = (2.9589904599999994e+00 + -7.8133309999999678e-02 * logT + T * (3.8713548500000049e-04 + T * (-1.8243786666666668e-07 + T * (3.2732628000000005e-11 + -2.1864630050000003e-15 * T))) - -3.3703387899999998e+03 / T);
+  }
+
+  k[82] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.3951521279000000e+01 + 2.5318502700000001e+00 * logT + T * (-4.5722039703526667e-03 + T * (2.0842296336659861e-06 + T * (-8.6614005852506782e-10 + 1.8627687954638660e-13 * T))) - -4.1679152872999999e+04 / T);
+  } else {
+    Kc = (9.1412373340000013e+00 + -1.1728297299999999e+00 * logT + T * (6.3955068499214895e-04 + T * (-2.1112456135936572e-07 + T * (3.6033552561262686e-11 + -2.3616933449098688e-15 * T))) - -4.0547483641999999e+04 / T);
+  }
+
+  k[83] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4264257104999999e+01 + 3.0594018300000001e+00 * logT + T * (-3.8034803853526662e-03 + T * (8.3494749533265330e-07 + T * (-2.8122263185840132e-10 + 9.1618102046386617e-14 * T))) - -6.3921816399999989e+03 / T);
+  } else {
+    Kc = (1.1366069423999999e+01 + -8.9219361999999913e-01 * logT + T * (-4.1583445457851580e-05 + T * (-3.4042378026032449e-08 + T * (9.4412827612626981e-12 + -6.9240211490986809e-16 * T))) - -4.9672511200000008e+03 / T);
+  }
+
+  k[84] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.8114685991999998e+01 + 3.7910406700000001e+00 * logT + T * (-5.8098216453526660e-03 + T * (1.5691487186659867e-06 + T * (-3.9987453602506809e-10 + 8.1975777046386616e-14 * T))) - -6.2491713999999993e+03 / T);
+  } else {
+    Kc = (1.2055147804000001e+01 + -9.4476809999999967e-01 * logT + T * (-5.1934628345785112e-04 + T * (8.0065332640634201e-08 + T * (-6.1315901887372989e-12 + 1.9873111009013207e-16 * T))) - -4.6797898199999981e+03 / T);
+  }
+
+  k[85] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0113989271000001e+01 + -2.0071755200000001e+00 * logT + T * (1.4404078344647334e-02 + T * (-1.3131591431334014e-05 + T * (6.7320580914749317e-09 + -1.4570857314536132e-12 * T))) - -3.9427431429999997e+03 / T);
+  } else {
+    Kc = (-1.4190507516000000e+01 + 2.7402369699999998e+00 * logT + T * (-2.7487318400078505e-03 + T * (5.1890898530730080e-07 + T * (-6.4503550272070642e-11 + 3.6115168500901318e-15 * T))) - -4.2914503919999988e+03 / T);
+  }
+
+  k[86] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.9550829021000002e+01 + -3.7648607000000003e+00 * logT + T * (1.5214014324647333e-02 + T * (-1.3230632416334013e-05 + T * (6.9883551914749320e-09 + -1.5717888704536133e-12 * T))) - 2.2977162699999826e+02 / T);
+  } else {
+    Kc = (-1.7149497975999999e+01 + 2.8183702799999999e+00 * logT + T * (-3.1358673250078510e-03 + T * (7.0134685197396748e-07 + T * (-9.7236178272070646e-11 + 5.7979798550901317e-15 * T))) - -9.2111160199999722e+02 / T);
+  }
+
+  k[87] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.2744399808999999e+01 + -3.5809762359999997e+00 * logT + T * (4.9758008996473339e-03 + T * (-1.1733718996673462e-06 + T * (-1.2198840019173490e-10 + 1.2162106804638661e-13 * T))) - -6.5884072400000005e+04 / T);
+  } else {
+    Kc = (-5.8992561560000008e+00 + -5.2023688999999962e-01 * logT + T * (6.0472382154214870e-04 + T * (-8.9179627692699182e-08 + T * (1.3601826977929366e-11 + -9.2001223990986784e-16 * T))) - -6.6658725700000010e+04 / T);
+  }
+
+  k[88] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.8862673529999983e+00 + 9.0378535599999998e-01 * logT + T * (-1.0923385640352666e-02 + T * (1.0239687116999320e-05 + T * (-5.3150857001917346e-09 + 1.1607908520463867e-12 * T))) - -1.7042793799999999e+04 / T);
+  } else {
+    Kc = (1.3095133554000000e+01 + -2.6308456500000004e+00 * logT + T * (2.1842812915421491e-03 + T * (-3.8464583102603240e-07 + T * (4.5851726144596027e-11 + -2.5068591649098675e-15 * T))) - -1.6796785199999998e+04 / T);
+  }
+
+  k[89] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.2132614670000001e+00 + -7.5326497000000003e-01 * logT + T * (-4.5426570453526664e-03 + T * (5.1963480003326537e-06 + T * (-2.7827575501917343e-09 + 6.1366750004638666e-13 * T))) - -5.5243730769999995e+04 / T);
+  } else {
+    Kc = (6.4453412840000022e+00 + -2.4806128500000000e+00 * logT + T * (2.1575929615421478e-03 + T * (-3.3832594602603260e-07 + T * (3.7883029561262699e-11 + -1.9722678699098683e-15 * T))) - -5.5146647660000002e+04 / T);
+  }
+
+  k[90] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.1183121770000000e+00 + -2.5594542359999997e+00 * logT + T * (1.4913646014647333e-02 + T * (-1.3486045616334013e-05 + T * (6.9948531498082656e-09 + -1.5295967324536134e-12 * T))) - -3.4822461173000003e+04 / T);
+  } else {
+    Kc = (-1.3744070216000001e+01 + 1.9681248300000003e+00 * logT + T * (-2.2089825050078519e-03 + T * (4.6788862197396742e-07 + T * (-6.0815591522070634e-11 + 3.5081359950901315e-15 * T))) - -3.5100693522000001e+04 / T);
+  }
+
+  k[91] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.2092969330000005e+00 + -1.1527358000000003e+00 * logT + T * (1.6919667746473337e-03 + T * (-1.2307914163340125e-06 + T * (7.7051789147493195e-10 + -1.9687684495361349e-13 * T))) - -1.7721809329999996e+04 / T);
+  } else {
+    Kc = (6.1852026639999975e+00 + -1.5814547499999998e+00 * logT + T * (1.3759285615421489e-03 + T * (-2.1188125769269901e-07 + T * (2.3328972061262663e-11 + -1.1967757749098676e-15 * T))) - -1.7556026039999997e+04 / T);
+  }
+
+  k[92] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.4453062909999996e+00 + -9.0240390999999986e-01 * logT + T * (8.5329174196473335e-03 + T * (-8.4427064996673472e-06 + T * (4.4625249998082653e-09 + -9.8247338045361357e-13 * T))) - 3.3784757969999991e+03 / T);
+  } else {
+    Kc = (-7.0942779460000009e+00 + 1.8178920299999999e+00 * logT + T * (-2.1822941750078515e-03 + T * (4.2156873697396761e-07 + T * (-5.2846894938737338e-11 + 2.9735447000901318e-15 * T))) - 3.2491689380000025e+03 / T);
+  }
+
+  k[93] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.2133753299999954e-01 + -1.5150407599999998e+00 * logT + T * (-6.5747689035266588e-04 + T * (1.7049246836659875e-06 + T * (-9.1116399185840205e-10 + 1.9088383504638650e-13 * T))) - -4.9837491899999994e+04 / T);
+  } else {
+    Kc = (5.4826342439999998e+00 + -2.3827749300000001e+00 * logT + T * (2.1439977615421487e-03 + T * (-3.4059000602603242e-07 + T * (3.8495260394596016e-11 + -2.0180657249098672e-15 * T))) - -4.9757573099999994e+04 / T);
+  }
+
+  k[94] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0227478909999994e+00 + -5.0293307999999959e-01 * logT + T * (2.2982935996473334e-03 + T * (-2.0155670830006801e-06 + T * (9.0924955814159900e-10 + -1.7192903545361343e-13 * T))) - -3.4143445642999999e+04 / T);
+  } else {
+    Kc = (-6.8341393259999972e+00 + 9.1873392999999970e-01 * logT + T * (-1.4006297750078518e-03 + T * (2.9512404864063403e-07 + T * (-3.8292837438737276e-11 + 2.1980526050901319e-15 * T))) - -3.4341452681999996e+04 / T);
+  }
+
+  k[95] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.3107072910000004e+00 + -1.4062812000000013e-01 * logT + T * (4.6477372646473326e-03 + T * (-4.9512831830006802e-06 + T * (2.5909314414749330e-09 + -5.5968971545361342e-13 * T))) - -2.0277630730000001e+03 / T);
+  } else {
+    Kc = (-6.1315709060000003e+00 + 1.7200541100000000e+00 * logT + T * (-2.1686989750078507e-03 + T * (4.2383279697396743e-07 + T * (-5.3459125772070629e-11 + 3.0193425550901323e-15 * T))) - -2.1399056219999966e+03 / T);
+  }
+
+  k[96] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.2330860013999999e+01 + 3.0264161799999996e+00 * logT + T * (-1.0315994435352666e-02 + T * (5.4964795886659863e-06 + T * (-1.9214094106917351e-09 + 3.0526019859638665e-13 * T))) - -9.3803786000000000e+03 / T);
+  } else {
+    Kc = (2.3943113604000001e+01 + -3.1209817800000001e+00 * logT + T * (1.3165368615421487e-03 + T * (-2.3621509285936584e-07 + T * (3.0141541061262699e-11 + -1.7464288299098680e-15 * T))) - -8.0267475999999988e+03 / T);
+  }
+
+  k[97] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.4442458709999997e+00 + -3.9783779999999602e-02 * logT + T * (3.7583348246473334e-03 + T * (-4.3020840996673466e-06 + T * (2.3407493931415991e-09 + -5.2140112795361339e-13 * T))) - 7.1077196699999968e+02 / T);
+  } else {
+    Kc = (-9.2750347709999996e+00 + 1.9541876700000005e+00 * logT + T * (-2.4838299000078511e-03 + T * (5.1256640197396746e-07 + T * (-6.8054312605403973e-11 + 4.0050762600901320e-15 * T))) - 4.5444928800000253e+02 / T);
+  }
+
+  k[98] = exp(Kc);
+
+  k[99] = exp(3.1725365678150649e+01 - 1.25 * logT);
+  k[100] = exp(3.3940939394155066e+01 - 2.0 * logT);
+  k[101] = exp(3.7629818848269004e+01 - 2.0 * logT);
+  k[102] = exp(2.2102031931645509e+01 - (3.3766032802049818e+02 / T));
+  k[103] = exp(2.4525473976367351e+01 - (5.3743849526958581e+02 / T));
+  k[104] = exp(2.5154082635789724e+01 - (3.1954442368556835e+02 / T));
+  k[105] = exp(9.4009607315848331e+00 + 2.0 * logT - (2.6167417372676464e+03 / T));
+  k[106] = exp(2.3025850929940457e+01 - (1.8115904334929860e+03 / T));
+  k[107] = exp(3.0262909956065194e+01 - 0.534 * logT - (2.6972568676451124e+02 / T));
+  k[108] = exp(1.3399995114002609e+01 + 1.62 * logT - (5.4549000830733239e+03 / T));
+  k[109] = exp(2.0809443533187462e+01 + 0.48 * logT - (-1.3083708686338232e+02 / T));
+  k[110] = exp(2.0107079697522593e+01 + 0.454 * logT - (1.8115904334929860e+03 / T));
+  k[111] = exp(2.0107079697522593e+01 + 0.454 * logT - (1.3083708686338232e+03 / T));
+  k[112] = exp(1.0957799582307658e+01 + 1.9 * logT - (1.3798280468438243e+03 / T));
+  k[113] = exp(2.0776806603874441e+01 + 0.5 * logT - (4.3276882577887996e+01 / T));
+  k[114] = exp(1.8921456031864853e+01 + 0.65 * logT - (-1.4291435642000221e+02 / T));
+  k[115] = exp(2.4213694352336510e+01 - 0.09 * logT - (3.0696393456408930e+02 / T));
+  k[116] = exp(2.1611157094298868e+01 + 0.515 * logT - (2.5160978242958137e+01 / T));
+  k[117] = exp(1.0633448706218790e+01 + 1.63 * logT - (9.6819444278902915e+02 / T));
+  k[118] = exp(2.1128730945054574e+01 + 0.5 * logT - (-5.5354152134507899e+01 / T));
+  k[119] = exp(2.6291610340707507e+01 - 0.23 * logT - (5.3844493439930409e+02 / T));
+  k[120] = exp(9.7409686230383539e+00 + 2.1 * logT - (2.4506792808641226e+03 / T));
+  k[121] = exp(8.3428398042714598e+00 + 2.1 * logT - (2.4506792808641226e+03 / T));
+  k[122] = exp(3.2236191301916641e+01 - 1.0 * logT);
+  k[123] = exp(2.2446032434687513e+01 - (1.2077269556619906e+03 / T));
+  k[124] = exp(2.2528270532924488e+01 + 0.27 * logT - (1.4090147816056557e+02 / T));
+  k[125] = exp(2.0107079697522593e+01 + 0.454 * logT - (9.1585960804367619e+02 / T));
+  k[126] = exp(7.1891677384203225e+00 + 2.53 * logT - (6.1594074738761519e+03 / T));
+  k[127] = exp(3.3886771157681913e+01 - 0.99 * logT - (7.9508691247747720e+02 / T));
+  k[128] = exp(1.1652687407345388e+01 + 1.9 * logT - (3.7892433233894953e+03 / T));
+  k[129] = exp(2.4635288842374557e+01 - (4.0257565188733020e+03 / T));
+  if (T <= 1000.0) {
+    Kc = (-9.2732791070000005e+00 + 2.6172875700000002e+00 * logT + T * (-8.3591370153526662e-03 + T * (4.0236300486659861e-06 + T * (-1.2756786706917347e-09 + 1.8270044959638663e-13 * T))) - -1.6329829059999996e+04 / T);
+  } else {
+    Kc = (1.8123589218999999e+01 + -2.0103939999999998e+00 * logT + T * (1.4941518654214866e-04 + T * (3.0571180473967510e-08 + T * (-8.1340187720706394e-12 + 6.2018043009013177e-16 * T))) - -1.5298894890000000e+04 / T);
+  }
+
+  k[130] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.5521339999999988e+00 + 8.9346299999999990e-01 * logT + T * (-6.4766644500000008e-03 + T * (5.5786861000000013e-06 + T * (-2.8160962766666671e-09 + 6.0000089250000002e-13 * T))) - -1.5074532340000000e+04 / T);
+  } else {
+    Kc = (9.6465531850000001e+00 + -1.4125317800000001e+00 * logT + T * (1.1056187249999998e-03 + T * (-2.6725665833333327e-07 + T * (3.9455622666666665e-11 + -2.4771859549999999e-15 * T))) - -1.4815679110000001e+04 / T);
+  }
+
+  k[131] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.4584651780000000e+00 + -1.3014144000000005e-01 * logT + T * (-8.6392503799999978e-03 + T * (9.2972229116666652e-06 + T * (-4.9160617820000005e-09 + 1.0728903654500000e-12 * T))) - 9.5306447299999854e+02 / T);
+  } else {
+    Kc = (1.3334433319999999e+01 + -3.2917747299999993e+00 * logT + T * (3.5934379315500000e-03 + T * (-6.5386985616666657e-07 + T * (7.9660458833333329e-11 + -4.4023165000000007e-15 * T))) - 1.1061990220000007e+03 / T);
+  }
+
+  k[132] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.2370938509999996e+00 + 3.6229401000000028e-01 * logT + T * (-3.8078186646473330e-03 + T * (3.5634357830006797e-06 + T * (-1.8136705573082654e-09 + 3.8919905395361339e-13 * T))) - -7.5172121869999974e+03 / T);
+  } else {
+    Kc = (4.1445887660000000e+00 + -8.9617436999999978e-01 * logT + T * (8.3894538700785145e-04 + T * (-1.3167241797396752e-07 + T * (1.4205879822070641e-11 + -7.4733377509013206e-16 * T))) - -7.4391352780000016e+03 / T);
+  }
+
+  k[133] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.3508198260000004e+00 + -2.7079181700000001e+00 * logT + T * (2.1299063115000003e-03 + T * (1.2496155466666669e-06 + T * (-1.1512345533333333e-09 + 2.9481571150000003e-13 * T))) - -2.4932743220000000e+04 / T);
+  } else {
+    Kc = (-4.0164630899999985e+00 + -1.0207724900000006e+00 * logT + T * (1.9057287540000000e-03 + T * (-3.5906711766666662e-07 + T * (4.5589858100000000e-11 + -2.6136652849999998e-15 * T))) - -2.5579101699999999e+04 / T);
+  }
+
+  k[134] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.0278753680000001e+00 + -6.1712319999999954e-01 * logT + T * (-2.5655894999999994e-04 + T * (6.5459820833333341e-07 + T * (-3.2114751666666664e-10 + 5.7820423999999999e-14 * T))) - -8.4016286199999995e+03 / T);
+  } else {
+    Kc = (1.3800786099999995e+00 + -5.8236206999999984e-01 * logT + T * (4.9704224715000007e-04 + T * (-6.2522419183333327e-08 + T * (5.7360453583333335e-12 + -2.7170195449999994e-16 * T))) - -8.5040320000000029e+03 / T);
+  }
+
+  k[135] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.9137694999999981e-01 + -3.1271651999999950e-01 * logT + T * (1.0586348849999999e-03 + T * (-1.5680872316666664e-06 + T * (1.0823547516666667e-09 + -2.8203297000000007e-13 * T))) - -3.5267558860000005e+04 / T);
+  } else {
+    Kc = (2.9517713799999998e+00 + -7.9356824000000037e-01 * logT + T * (4.3587786700000010e-04 + T * (-6.9147710833333326e-08 + T * (7.1773627999999992e-12 + -2.9010321499999993e-16 * T))) - -3.5063268533000002e+04 / T);
+  }
+
+  k[136] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.9580548999999969e-01 + 2.3231045000000039e-01 * logT + T * (-1.9207073365000000e-03 + T * (1.0545304499999991e-06 + T * (-3.5884544916666708e-10 + 5.3778554000000095e-14 * T))) - -1.5911417119999998e+04 / T);
+  } else {
+    Kc = (1.5657066599999991e+00 + -2.0668712999999928e-01 * logT + T * (-5.2000424300000002e-04 + T * (1.6285939233333333e-07 + T * (-2.2169620616666662e-11 + 1.1539419300000000e-15 * T))) - -1.5889309687000001e+04 / T);
+  }
+
+  k[137] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.9893508499999975e-01 + -4.6672151000000017e-01 * logT + T * (1.0562507823526665e-03 + T * (-7.2248605449931987e-07 + T * (4.6003117544173469e-10 + -1.2675303229638663e-13 * T))) - -7.7929389859999996e+04 / T);
+  } else {
+    Kc = (-1.5358240939999996e+00 + -3.7037093000000043e-01 * logT + T * (7.3305438125785148e-04 + T * (-1.7548291347396754e-07 + T * (2.3380837997070637e-11 + -1.3616614885901323e-15 * T))) - -7.7988164799999999e+04 / T);
+  }
+
+  k[138] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.7282501949999998e+00 + -7.6064623999999936e-01 * logT + T * (-5.8322167014733365e-04 + T * (1.8084994730006798e-06 + T * (-1.0496207698082652e-09 + 2.1898323095361339e-13 * T))) - -4.5099149099999995e+04 / T);
+  } else {
+    Kc = (8.9163925999999893e-02 + -6.9917801000000024e-01 * logT + T * (1.7188059199578511e-03 + T * (-4.5923449947396753e-07 + T * (6.7316314822070638e-11 + -4.1350023250901320e-15 * T))) - -4.5385515350000016e+04 / T);
+  }
+
+  k[139] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.4150539499999955e-01 + -4.6097095000000010e-01 * logT + T * (-4.2379441561473333e-03 + T * (4.9848606630006798e-06 + T * (-2.5163734364749319e-09 + 5.0628666545361342e-13 * T))) - -3.8454417459999997e+04 / T);
+  } else {
+    Kc = (4.2680494560000000e+00 + -1.7062987100000002e+00 * logT + T * (2.4975890804578515e-03 + T * (-5.2335789530730078e-07 + T * (6.9514893488737301e-11 + -4.0677022200901327e-15 * T))) - -3.8644433400000002e+04 / T);
+  }
+
+  k[140] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.5739063000000009e-01 + -6.6236889999999882e-02 * logT + T * (-1.4007659100000007e-04 + T * (-4.3023756000000001e-07 + T * (4.5052062583333339e-10 + -1.3428221950000000e-13 * T))) - -9.1155539600000011e+03 / T);
+  } else {
+    Kc = (-1.4160766999999996e-01 + -5.4531579999999913e-02 * logT + T * (-5.2849545749999983e-04 + T * (2.1046897983333336e-07 + T * (-3.3330269116666668e-11 + 2.0729778299999996e-15 * T))) - -9.1141216999999924e+03 / T);
+  }
+
+  k[141] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.9260708619999996e+00 + -8.9689639000000021e-01 * logT + T * (-2.5702009896473336e-03 + T * (4.0785166980006795e-06 + T * (-2.2799360798082651e-09 + 4.9350015645361341e-13 * T))) - -4.2947193659999997e+04 / T);
+  } else {
+    Kc = (1.2306782960000007e+00 + -1.1242360000000000e+00 * logT + T * (1.9978423554578512e-03 + T * (-4.2286231197396749e-07 + T * (5.6371022572070625e-11 + -3.3077582300901327e-15 * T))) - -4.3306829100000003e+04 / T);
+  }
+
+  k[142] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0545270920000003e+00 + -9.5021000999999972e-01 * logT + T * (-7.4202735650000006e-03 + T * (9.1493264216666673e-06 + T * (-5.0273651100000005e-09 + 1.1113648879999998e-12 * T))) - -4.5702844960000002e+04 / T);
+  } else {
+    Kc = (5.1344918899999987e+00 + -2.5888974800000000e+00 * logT + T * (3.1527495569999998e-03 + T * (-5.8406168299999986e-07 + T * (7.2831030133333355e-11 + -4.1043009099999999e-15 * T))) - -4.6009115999999995e+04 / T);
+  }
+
+  k[143] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0828526300000001e+00 + 2.9571340000000079e-01 * logT + T * (-3.3859809350000002e-04 + T * (-1.7214274166666665e-07 + T * (1.1778545249999987e-10 + -2.2428833999999994e-14 * T))) - -4.3497659600000025e+03 / T);
+  } else {
+    Kc = (-2.3482927800000000e+00 + 5.2948823000000012e-01 * logT + T * (-9.7750956300000002e-04 + T * (2.1460329399999996e-07 + T * (-2.8716743866666666e-11 + 1.6510772150000001e-15 * T))) - -4.3749343999999983e+03 / T);
+  }
+
+  k[144] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.8504288870000001e+00 + 7.3163884000000001e-01 * logT + T * (-2.0063412599999999e-03 + T * (7.3420122333333307e-07 + T * (-1.1865190416666682e-10 + -9.6423250000000015e-15 * T))) - 1.4301023999999961e+02 / T);
+  } else {
+    Kc = (6.8907837999999888e-01 + -5.2574480000000090e-02 * logT + T * (-4.7776283799999975e-04 + T * (1.1410771066666666e-07 + T * (-1.5572872949999997e-11 + 8.9113322500000016e-16 * T))) - 2.8746130000000267e+02 / T);
+  }
+
+  k[145] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.7704219399999994e+00 + -1.2696605999999995e+00 * logT + T * (8.0234069850000003e-03 + T * (-6.9245629400000004e-06 + T * (3.3330242550000006e-09 + -6.8588373949999998e-13 * T))) - -7.2171608599999963e+03 / T);
+  } else {
+    Kc = (-1.1619143255000001e+01 + 2.1519710450000002e+00 * logT + T * (-2.2612790030000001e-03 + T * (4.0918947733333328e-07 + T * (-5.3028044783333331e-11 + 3.0089326100000001e-15 * T))) - -7.6190252099999998e+03 / T);
+  }
+
+  k[146] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.7646609250000012e+00 + -2.7147753799999998e+00 * logT + T * (5.9981339853526668e-03 + T * (-2.1263859053326532e-06 + T * (4.5277647235840132e-10 + -3.0169487496386613e-14 * T))) - -1.2169304360000002e+04 / T);
+  } else {
+    Kc = (-1.1019815694000000e+01 + 5.4938702000000017e-01 * logT + T * (9.0170654545785114e-04 + T * (-2.2374891347396753e-07 + T * (3.1781944238737311e-11 + -1.9292440950901323e-15 * T))) - -1.2992290699999998e+04 / T);
+  }
+
+  k[147] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.9604265999999893e-01 + -4.3502724000000059e-01 * logT + T * (1.4992275299999999e-03 + T * (-1.8101110949999999e-06 + T * (1.0512148244999999e-09 + -2.4171248394999997e-13 * T))) - -5.2092458220000000e+04 / T);
+  } else {
+    Kc = (-1.3736992499999996e+00 + -1.1588395000000018e-01 * logT + T * (-6.3296975299999975e-04 + T * (1.9917543550000000e-07 + T * (-3.0683716783333336e-11 + 1.9032480549999999e-15 * T))) - -5.2026744650000001e+04 / T);
+  }
+
+  k[148] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.4123649599999997e+00 + -3.6591217999999914e-01 * logT + T * (3.5146458949999997e-03 + T * (-3.6065987499999994e-06 + T * (1.9172732924999999e-09 + -4.2158565400000006e-13 * T))) - -1.5760285599999997e+04 / T);
+  } else {
+    Kc = (-4.3204932000000005e+00 + 9.5258912000000007e-01 * logT + T * (-1.3072786180000002e-03 + T * (2.7459237566666661e-07 + T * (-3.5528847783333325e-11 + 2.0056777250000003e-15 * T))) - -1.5855203649999999e+04 / T);
+  }
+
+  k[149] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.7517753799999998e+00 + 1.1364591000000002e+00 * logT + T * (-7.5700866550000006e-03 + T * (5.5486244316666665e-06 + T * (-2.4235135158333333e-09 + 4.6077279450000004e-13 * T))) - -4.5023850290000002e+04 / T);
+  } else {
+    Kc = (1.0326835640000002e+01 + -1.9908707899999998e+00 * logT + T * (1.0913605869999998e-03 + T * (-1.6035911266666659e-07 + T * (1.7506804383333322e-11 + -9.2256411500000039e-16 * T))) - -4.4616280129999999e+04 / T);
+  }
+
+  k[150] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.6188615130000002e+01 + 2.8941442800000003e+00 * logT + T * (-8.3800226349999996e-03 + T * (5.6476654166666667e-06 + T * (-2.6798106158333328e-09 + 5.7547593350000009e-13 * T))) - -4.9196365059999996e+04 / T);
+  } else {
+    Kc = (1.3285826100000001e+01 + -2.0690040999999999e+00 * logT + T * (1.4784960720000003e-03 + T * (-3.4279697933333327e-07 + T * (5.0239432383333326e-11 + -3.1090271200000005e-15 * T))) - -4.7986618920000001e+04 / T);
+  }
+
+  k[151] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.8768954200000012e+00 + -1.6448815099999998e+00 * logT + T * (1.0596259680000001e-02 + T * (-9.5681556483333339e-06 + T * (4.9183875341666663e-09 + -1.0678866774999998e-12 * T))) - -1.1459955330000004e+04 / T);
+  } else {
+    Kc = (-1.0045918750000000e+01 + 1.8440626000000002e+00 * logT + T * (-1.9097864529999996e-03 + T * (3.8723656733333325e-07 + T * (-5.0297670450000001e-11 + 2.8641830749999994e-15 * T))) - -1.1730585670000000e+04 / T);
+  }
+
+  k[152] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.7313735170000001e+01 + -3.4025666900000000e+00 * logT + T * (1.1406195660000000e-02 + T * (-9.6671966333333349e-06 + T * (5.1746846341666666e-09 + -1.1825898164999999e-12 * T))) - -7.2874405600000027e+03 / T);
+  } else {
+    Kc = (-1.3004909209999999e+01 + 1.9221959099999995e+00 * logT + T * (-2.2969219380000001e-03 + T * (5.6967443399999993e-07 + T * (-8.3030298450000006e-11 + 5.0506460800000001e-15 * T))) - -8.3602468799999988e+03 / T);
+  }
+
+  k[153] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.0546465849999986e+00 + -2.1299513599999997e+00 * logT + T * (3.3231887103526668e-03 + T * (2.1651781334013507e-08 + T * (-6.9351768064159861e-10 + 2.2512776495361328e-13 * T))) - -2.4921364860000009e+04 / T);
+  } else {
+    Kc = (-1.7357044884000000e+01 + 1.8675116199999993e+00 * logT + T * (-6.0765432954214878e-04 + T * (1.9651809692699142e-08 + T * (5.8347015720706415e-12 + -6.7128960509013197e-16 * T))) - -2.6178847100000006e+04 / T);
+  }
+
+  k[154] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.9019542709999975e+00 + -1.6486022400000011e-01 * logT + T * (-1.4206866396473342e-03 + T * (2.2507492813340137e-06 + T * (-1.2325112239749320e-09 + 2.5610194445361339e-13 * T))) - -1.1613319400000000e+04 / T);
+  } else {
+    Kc = (-2.8316906189999989e+00 + -2.2915998000000082e-01 * logT + T * (1.2467505354578513e-03 + T * (-3.2049217364063418e-07 + T * (4.5323321822070636e-11 + -2.7550767950901321e-15 * T))) - -1.1872049410000000e+04 / T);
+  }
+
+  k[155] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.5017972900000132e-01 + -1.0583232240000000e+00 * logT + T * (5.0559778103526666e-03 + T * (-3.3279368186659867e-06 + T * (1.5835850526917346e-09 + -3.4389894804638668e-13 * T))) - 3.4612129400000013e+03 / T);
+  } else {
+    Kc = (-1.2478243803999998e+01 + 1.1833717999999998e+00 * logT + T * (1.4113181045785107e-04 + T * (-5.3235515307300855e-08 + T * (5.8676991554039706e-12 + -2.7789084009013220e-16 * T))) - 2.9436297000000013e+03 / T);
+  }
+
+  k[156] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0749448835999999e+01 + 2.2876013660000005e+00 * logT + T * (-4.7933591900000006e-03 + T * (1.4904491833333333e-06 + T * (-1.1914707499999943e-11 + -1.0122789449999994e-13 * T))) - 6.5016052400000044e+03 / T);
+  } else {
+    Kc = (9.3949082600000011e+00 + -1.0386583000000003e+00 * logT + T * (2.0952035200000026e-04 + T * (4.0750000666666695e-08 + T * (-1.4359812533333338e-11 + 1.1739552949999999e-15 * T))) - 7.3221117000000013e+03 / T);
+  }
+
+  k[157] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.1175233377999998e+01 + 2.4524273460000003e+00 * logT + T * (-9.7798236550000021e-03 + T * (6.2743793299999998e-06 + T * (-2.5081898946666667e-09 + 4.3880239404999997e-13 * T))) - -2.7943148459999997e+04 / T);
+  } else {
+    Kc = (1.5291898600000003e+01 + -2.2395539800000006e+00 * logT + T * (1.3961657219999999e-03 + T * (-2.8992099316666664e-07 + T * (3.7189303050000000e-11 + -2.1348963650000003e-15 * T))) - -2.7170944299999999e+04 / T);
+  }
+
+  k[158] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.8812183259999999e+00 + -2.1971602259999994e+00 * logT + T * (1.1105827350000000e-02 + T * (-9.9226098333333329e-06 + T * (5.1811825925000002e-09 + -1.1403976785000000e-12 * T))) - -4.2339673360000001e+04 / T);
+  } else {
+    Kc = (-9.5994814500000025e+00 + 1.0719504600000005e+00 * logT + T * (-1.3700371180000001e-03 + T * (3.3621620399999992e-07 + T * (-4.6609711699999999e-11 + 2.7608022199999998e-15 * T))) - -4.2539828800000003e+04 / T);
+  }
+
+  k[159] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.2082124400000005e+00 + -5.4010989999999914e-01 * logT + T * (4.7250987550000005e-03 + T * (-4.8792707166666667e-06 + T * (2.6488544424999991e-09 + -5.9327432650000018e-13 * T))) - -4.1387363899999982e+03 / T);
+  } else {
+    Kc = (-2.9496891800000018e+00 + 9.2171766000000011e-01 * logT + T * (-1.3433487879999997e-03 + T * (2.8989631900000027e-07 + T * (-3.8641015116666684e-11 + 2.2262109250000002e-15 * T))) - -4.1899663399999990e+03 / T);
+  }
+
+  k[160] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0736134400000008e+00 + 2.2166589000000014e-01 * logT + T * (8.3991859999999960e-04 + T * (-1.3878474000000007e-06 + T * (7.7726088416666741e-10 + -1.7049066149999997e-13 * T))) - -9.5449752599999956e+03 / T);
+  } else {
+    Kc = (-1.9869821400000007e+00 + 8.2387974000000019e-01 * logT + T * (-1.3297535879999995e-03 + T * (2.9216037899999999e-07 + T * (-3.9253245950000001e-11 + 2.2720087799999998e-15 * T))) - -9.5790408999999963e+03 / T);
+  }
+
+  k[161] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.9284798000000123e-01 + 3.2251023000000067e-01 * logT + T * (-4.9483839999999585e-05 + T * (-7.3864831666666654e-07 + T * (5.2707883583333358e-10 + -1.3220207400000005e-13 * T))) - -6.8064402199999995e+03 / T);
+  } else {
+    Kc = (-5.1304460049999996e+00 + 1.0580132999999998e+00 * logT + T * (-1.6448845129999994e-03 + T * (3.8089398399999996e-07 + T * (-5.3848432783333332e-11 + 3.2577424849999999e-15 * T))) - -6.9846859899999990e+03 / T);
+  }
+
+  k[162] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.0442853999999988e-01 + -5.4502696999999989e-01 * logT + T * (2.9793422214999996e-03 + T * (-2.6226176816666659e-06 + T * (1.4412002008333338e-09 + -3.3581152400000011e-13 * T))) - -1.9356141739999999e+04 / T);
+  } else {
+    Kc = (1.3860647200000007e+00 + -5.8688111000000109e-01 * logT + T * (9.5588210999999991e-04 + T * (-2.3200710316666665e-07 + T * (2.9346983416666660e-11 + -1.4440451450000000e-15 * T))) - -1.9173958846000001e+04 / T);
+  }
+
+  k[163] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.5015687580000012e+00 + 7.2126190000000001e-01 * logT + T * (-4.2647014214999999e-03 + T * (2.9977919499999997e-06 + T * (-1.1401965416666665e-09 + 1.7808557350000002e-13 * T))) - -5.6992724280000002e+04 / T);
+  } else {
+    Kc = (1.0214457990000001e+01 + -2.0377342800000005e+00 * logT + T * (1.9261087430000004e-03 + T * (-3.7557979699999998e-07 + T * (4.5336670449999998e-11 + -2.3540358100000002e-15 * T))) - -5.6512636013000003e+04 / T);
+  }
+
+  k[164] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.2617988899999997e+00 + 9.5694408000000042e-01 * logT + T * (-6.9647721000000006e-03 + T * (5.3564757083333336e-06 + T * (-2.2506695033333334e-09 + 4.0385076949999996e-13 * T))) - -2.8050398000000001e+04 / T);
+  } else {
+    Kc = (1.4570914634999999e+01 + -2.9455392850000006e+00 * logT + T * (2.6971568700000000e-03 + T * (-4.7833718816666659e-07 + T * (6.0205407583333335e-11 + -3.2990358250000004e-15 * T))) - -2.7444243322999999e+04 / T);
+  }
+
+  k[165] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.6041937419999979e+00 + -1.8771689800000000e+00 * logT + T * (3.7767231199999996e-03 + T * (-2.8220162083333331e-06 + T * (1.6573995266666667e-09 + -4.1981919400000005e-13 * T))) - -1.2146125180000001e+04 / T);
+  } else {
+    Kc = (-5.4196608899999994e+00 + 5.6075804999999956e-01 * logT + T * (-5.2989689199999998e-04 + T * (1.8182047633333330e-07 + T * (-3.3619505800000002e-11 + 2.4060685249999999e-15 * T))) - -1.2900951492999999e+04 / T);
+  }
+
+  k[166] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.1045975619999995e+00 + -1.5325425300000002e+00 * logT + T * (5.9713767200000002e-03 + T * (-4.1134546183333329e-06 + T * (1.8289533671666668e-09 + -3.5837057945000006e-13 * T))) - -3.0707611180000004e+04 / T);
+  } else {
+    Kc = (-5.0734071600000004e+00 + 2.1795145000000016e-01 * logT + T * (3.3022620799999991e-04 + T * (-7.5970815166666679e-08 + T * (7.6037212000000042e-12 + -2.1557768500000007e-16 * T))) - -3.0860493312999999e+04 / T);
+  }
+
+  k[167] = exp(Kc);
+
+  k[168] = exp(2.3148068562664704e+01 - (1.7250366683372099e+03 / T));
+  k[169] = exp(1.0668955394675699e+01 + 1.5 * logT - (4.0056277362789355e+04 / T));
+  k[170] = exp(1.2283033686666302e+01 + 1.51 * logT - (1.7260431074669282e+03 / T));
+  k[171] = exp(2.5027330930150580e+01 - 0.37 * logT);
+  k[172] = exp(3.5751506887855933e+00 + 2.4 * logT - (-1.0617932818528334e+03 / T));
+  k[173] = exp(2.3397414486372941e+01 - (-2.5160978242958137e+02 / T));
+  k[174] = exp(2.1416413017506358e+01 - (2.1487475419486250e+02 / T));
+  k[175] = exp(3.5069404645972853e+01 - (1.4799687402507976e+04 / T));
+  k[176] = exp(9.3325580047004326e+00 + 2.0 * logT - (1.5096586945774882e+03 / T));
+  k[177] = exp(3.5564817990743961e+01 - 1.43 * logT - (6.6928202126268650e+02 / T));
+  k[178] = exp(1.0933106969717286e+01 + 1.6 * logT - (2.7274500415366620e+03 / T));
+  k[179] = exp(3.4098719842032899e+01 - 1.34 * logT - (7.1306212340543357e+02 / T));
+  k[180] = exp(1.1512925464970229e+01 + 1.6 * logT - (1.5700450423605878e+03 / T));
+  k[181] = exp(1.0770588040219511e+01 + 1.228 * logT - (3.5225369540141394e+01 / T));
+  k[182] = exp(1.5048070819142122e+01 + 1.18 * logT - (-2.2493914549204575e+02 / T));
+  k[183] = exp(7.2723983925700466e+00 + 2.0 * logT - (-4.2270443448169669e+02 / T));
+  k[184] = exp(8.7483049123796235e+00 + 2.0 * logT - (7.5482934728874409e+02 / T));
+  k[185] = exp(-1.5338770774157322e+01 + 4.5 * logT - (-5.0321956485916274e+02 / T));
+  k[186] = exp(6.2225762680713688e+00 + 2.3 * logT - (6.7934641255986971e+03 / T));
+  k[187] = exp(1.0425253116340453e+01 + 2.0 * logT - (7.0450739080282783e+03 / T));
+  k[188] = exp(-1.4543249183293838e+01 + 4.0 * logT - (-1.0064391297183255e+03 / T));
+  k[189] = exp(8.1886891244442008e+00 + 2.0 * logT - (1.2580489121479068e+03 / T));
+  k[190] = exp(8.1718820061278201e+00 + 2.12 * logT - (4.3780102142747160e+02 / T));
+  k[191] = exp(2.2738168857488677e+01 - (1.0064391297183255e+03 / T));
+  k[192] = exp(1.8683045008419857e+01 - (-8.2024789072043529e+02 / T));
+  k[193] = exp(2.6763520548223823e+01 - (6.0386347783099527e+03 / T));
+  k[194] = exp(2.5733901131042668e+01 - (1.1875981730676242e+04 / T));
+  if (T <= 1000.0) {
+    Kc = (3.1081704499999998e+00 + -5.9822262999999953e-01 * logT + T * (5.4353532314999993e-03 + T * (-4.6611291999999993e-06 + T * (2.2761187416666672e-09 + -4.7536420800000006e-13 * T))) - 1.5113152000000264e+02 / T);
+  } else {
+    Kc = (-5.8861998599999996e+00 + 1.1592762499999996e+00 * logT + T * (-7.8727437500000037e-04 + T * (1.1173298333333328e-07 + T * (-1.3359227166666663e-11 + 8.5173579500000047e-16 * T))) - 3.4106036999997741e+01 / T);
+  }
+
+  k[195] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.0397461299999997e+00 + 4.1110465999999990e-01 * logT + T * (-2.8570031800000009e-04 + T * (-4.8686932750000001e-07 + T * (4.3270580191666671e-10 + -1.1510073024999998e-13 * T))) - -6.9601766439999992e+04 / T);
+  } else {
+    Kc = (2.8388916699999993e+00 + -4.9060032999999992e-01 * logT + T * (2.2273842395000021e-04 + T * (-2.1079523516666690e-08 + T * (-2.2387024833333325e-12 + 3.7040618199999978e-16 * T))) - -6.9297130879999997e+04 / T);
+  }
+
+  k[196] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.0970208699999962e-01 + -9.2726089000000034e-01 * logT + T * (6.3813133408526660e-03 + T * (-5.3342734594993203e-06 + T * (2.8385209101084016e-09 + -6.4435448684638660e-13 * T))) - -3.9134870199999990e+04 / T);
+  } else {
+    Kc = (-5.0845216540000004e+00 + 3.0103651999999981e-01 * logT + T * (5.2391857425785151e-04 + T * (-5.9415213640634190e-08 + T * (5.4846628040396918e-13 + 2.9611295640986774e-16 * T))) - -3.9120174399999989e+04 / T);
+  }
+
+  k[197] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0276298292999998e+01 + -2.9191488560000005e+00 * logT + T * (1.0836074437352667e-02 + T * (-6.9968653844993205e-06 + T * (2.9682210701084015e-09 + -5.6555542634638654e-13 * T))) - -4.9986241399999999e+04 / T);
+  } else {
+    Kc = (-1.6827722694000002e+01 + 1.8691830500000002e+00 * logT + T * (-6.6311134074214855e-04 + T * (1.1443807969269913e-07 + T * (-1.3808465052929363e-11 + 7.7323487640986804e-16 * T))) - -5.0817220500000003e+04 / T);
+  }
+
+  k[198] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.1256085000000020e-01 + 1.1717993000000071e-01 * logT + T * (-1.9251727705000001e-03 + T * (2.0441161999999999e-06 + T * (-1.0769461433333334e-09 + 2.3063553300000001e-13 * T))) - -3.6771525679999992e+04 / T);
+  } else {
+    Kc = (4.4638796899999988e+00 + -8.1940740999999973e-01 * logT + T * (1.2084899626500002e-03 + T * (-3.0483110951666671e-07 + T * (4.1696774341666675e-11 + -2.4029346545000000e-15 * T))) - -3.6694481430000007e+04 / T);
+  }
+
+  k[199] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.0797032209999999e+00 + 4.2853090000000016e-01 * logT + T * (-3.6677420736473333e-03 + T * (3.9936733430006793e-06 + T * (-2.2641911831415986e-09 + 5.2348127345361335e-13 * T))) - 1.5983417730000074e+03 / T);
+  } else {
+    Kc = (4.2861964360000000e+00 + -8.4164279000000031e-01 * logT + T * (1.3674408445078512e-03 + T * (-3.4214139780730081e-07 + T * (4.7536148938737302e-11 + -2.8203116050901321e-15 * T))) - 1.6749864219999945e+03 / T);
+  }
+
+  k[200] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.8411476499999990e-01 + -3.9473406000000022e-01 * logT + T * (-4.0978675651473333e-03 + T * (5.4150982230006794e-06 + T * (-2.9668940623082650e-09 + 6.4056888495361337e-13 * T))) - -2.9338863499999999e+04 / T);
+  } else {
+    Kc = (4.4096571260000008e+00 + -1.6517671300000003e+00 * logT + T * (3.0260845379578511e-03 + T * (-7.3382687514063420e-07 + T * (1.0284516260540396e-10 + -6.1406800500901323e-15 * T))) - -2.9530311700000013e+04 / T);
+  }
+
+  k[201] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.3790293542999999e+01 + -3.9438142259999998e+00 * logT + T * (1.1034427608352666e-02 + T * (-6.1038482103326536e-06 + T * (2.3919984968584015e-09 + -4.3910281304638660e-13 * T))) - -6.4898692899999995e+04 / T);
+  } else {
+    Kc = (-1.4228141144000002e+01 + 8.9500379000000008e-01 * logT + T * (6.6718000795785125e-04 + T * (-1.8474136480730088e-07 + T * (2.8160038855403975e-11 + -1.7479351200901321e-15 * T))) - -6.5866381300000008e+04 / T);
+  }
+
+  k[202] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.8262225870000002e+00 + -1.4509406000000000e+00 * logT + T * (-4.0999783514733361e-04 + T * (3.6466188813340132e-06 + T * (-2.6713986431415987e-09 + 6.7886603145361340e-13 * T))) - -2.6908785499999998e+04 / T);
+  } else {
+    Kc = (-6.9769524740000017e+00 + 3.5254155999999970e-01 * logT + T * (1.0597075629578522e-03 + T * (-3.0635427480730078e-07 + T * (4.6053006688737302e-11 + -2.8576601250901316e-15 * T))) - -2.7701486900000011e+04 / T);
+  }
+
+  k[203] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.3884320869999982e+00 + -2.1804912999999999e+00 * logT + T * (2.8883103948526665e-03 + T * (1.6013266580006797e-06 + T * (-1.9872288306415980e-09 + 5.8625661845361341e-13 * T))) - -2.9987209969999996e+04 / T);
+  } else {
+    Kc = (-1.5646406548999998e+01 + 1.5827949449999998e+00 * logT + T * (1.4177734795785149e-04 + T * (-1.8706111647396770e-07 + T * (3.1665977022070655e-11 + -2.0749384400901313e-15 * T))) - -3.1130545770000004e+04 / T);
+  }
+
+  k[204] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1715625360000001e+01 + -3.8176287199999996e+00 * logT + T * (8.9707695694999992e-03 + T * (-3.8428207800000003e-06 + T * (1.1005483205000003e-09 + -1.3779829655000002e-13 * T))) - -3.6393758399999992e+04 / T);
+  } else {
+    Kc = (-1.7268482670000001e+01 + 1.0345554600000000e+00 * logT + T * (5.2594949450000014e-04 + T * (-1.2317909733333330e-07 + T * (1.5574613416666670e-11 + -8.3254993499999971e-16 * T))) - -3.7533349000000009e+04 / T);
+  }
+
+  k[205] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.0364107300000001e+00 + 1.9541291400000005e+00 * logT + T * (-6.5813556555000003e-03 + T * (3.9348853783333332e-06 + T * (-1.5023972421666667e-09 + 2.4915271845000002e-13 * T))) - -3.2929844739999986e+04 / T);
+  } else {
+    Kc = (1.1108979619999999e+01 + -1.2485650300000004e+00 * logT + T * (8.1709937450000041e-04 + T * (-2.3548558599999998e-07 + T * (3.5534370583333333e-11 + -2.2057582299999997e-15 * T))) - -3.2393224650000018e+04 / T);
+  }
+
+  k[206] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.2729844667000000e+01 + -3.6477035000000004e+00 * logT + T * (1.3851685124852665e-02 + T * (-8.8379595919993197e-06 + T * (3.6758607093584009e-09 + -6.8928753404638662e-13 * T))) - -3.8057594839999998e+04 / T);
+  } else {
+    Kc = (-2.1327881219000002e+01 + 2.3721425199999997e+00 * logT + T * (-5.8365853704214884e-04 + T * (1.8124356859365808e-08 + T * (3.9684671887373099e-12 + -4.3530969509013098e-16 * T))) - -3.9093997309999999e+04 / T);
+  }
+
+  k[207] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.2270097859999982e+00 + -1.3533234860000001e+00 * logT + T * (2.3861763395000013e-03 + T * (-1.5137125866666667e-06 + T * (7.0702644283333312e-10 + -1.4662912344999990e-13 * T))) - -7.8771847699999984e+04 / T);
+  } else {
+    Kc = (6.6776013000000001e+00 + -1.6439152799999999e+00 * logT + T * (1.4839701445000001e-03 + T * (-3.2046087433333340e-07 + T * (4.5157708999999998e-11 + -2.7344199600000000e-15 * T))) - -7.8555524600000004e+04 / T);
+  }
+
+  k[208] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.1542412209999999e+00 + 6.6580609999999929e-02 * logT + T * (-3.4692205711473328e-03 + T * (3.7355785246673466e-06 + T * (-1.9314560098082654e-09 + 4.1162788795361337e-13 * T))) - -3.1674462269999967e+03 / T);
+  } else {
+    Kc = (6.4928815459999996e+00 + -1.4256625999999999e+00 * logT + T * (1.8164549500078514e-03 + T * (-3.4627571197396751e-07 + T * (4.2922623688737307e-11 + -2.3984109900901322e-15 * T))) - -3.0642008780000033e+03 / T);
+  }
+
+  k[209] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5869996764000000e+01 + -4.3723451259999999e+00 * logT + T * (1.4702169681999999e-02 + T * (-1.0097521553333333e-05 + T * (4.6561896800000000e-09 + -9.6258408650000009e-13 * T))) - -6.6497034673000002e+04 / T);
+  } else {
+    Kc = (-1.8514337579999999e+01 + 1.7366465799999999e+00 * logT + T * (-7.0026083654999970e-04 + T * (1.5740003300000003e-07 + T * (-1.9376110083333327e-11 + 1.0723764849999997e-15 * T))) - -6.7541367721999995e+04 / T);
+  }
+
+  k[210] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.4606195170000000e+00 + -9.7706759000000032e-01 * logT + T * (-5.2751731811473343e-03 + T * (8.0956520380006795e-06 + T * (-4.8697324598082650e-09 + 1.1378581384536135e-12 * T))) - -3.1885603070000001e+04 / T);
+  } else {
+    Kc = (-4.1688709639999981e+00 + -6.2370768000000032e-01 * logT + T * (1.8745608934578519e-03 + T * (-3.8578161397396770e-07 + T * (5.1363752688737337e-11 + -3.0108932200901318e-15 * T))) - -3.2625642260000001e+04 / T);
+  }
+
+  k[211] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.8532745699999982e+00 + -1.5653739999999998e+00 * logT + T * (8.3620050785000004e-03 + T * (-6.7524201983333334e-06 + T * (3.2152388025000006e-09 + -6.6345490549999999e-13 * T))) - -2.8673948999999957e+03 / T);
+  } else {
+    Kc = (-9.2708504749999996e+00 + 1.6224828150000001e+00 * logT + T * (-1.2837694399999997e-03 + T * (1.9458618333333327e-07 + T * (-2.4311300916666658e-11 + 1.3578553950000004e-15 * T))) - -3.2440908100000015e+03 / T);
+  }
+
+  k[212] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.2351082710000000e+01 + -4.2063758399999998e+00 * logT + T * (8.8801768185000005e-03 + T * (-3.5344100233333329e-06 + T * (1.0239901105000000e-09 + -1.3987844205000002e-13 * T))) - -3.8702872139999992e+04 / T);
+  } else {
+    Kc = (-1.2279644335000000e+01 + -7.7989420000000198e-02 * logT + T * (1.6423385499999999e-03 + T * (-2.9360410149999993e-07 + T * (3.6092777083333337e-11 + -2.0173145899999996e-15 * T))) - -3.9662784710000000e+04 / T);
+  }
+
+  k[213] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.8115991699999983e+00 + 7.7759984999999920e-01 * logT + T * (-8.8597276014999986e-03 + T * (7.9786596866666658e-06 + T * (-4.0236355238333331e-09 + 8.5948633554999997e-13 * T))) - -4.5547728300000002e+04 / T);
+  } else {
+    Kc = (1.6135475080000003e+01 + -2.7703973199999998e+00 * logT + T * (2.3255118050000004e-03 + T * (-4.4620809849999995e-07 + T * (5.8437151583333336e-11 + -3.4222443499999998e-15 * T))) - -4.5129817500000012e+04 / T);
+  }
+
+  k[214] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.7675762569999995e+00 + -4.3592543999999966e-01 * logT + T * (1.6677431665000002e-03 + T * (-9.0634396499999983e-07 + T * (2.3643735666666669e-10 + -1.2786509000000005e-14 * T))) - -4.4927762000000002e+03 / T);
+  } else {
+    Kc = (-3.0373711599999997e+00 + 5.8206271000000021e-01 * logT + T * (-4.9974672500000005e-04 + T * (1.0049558333333332e-07 + T * (-1.3143870916666673e-11 + 7.5994398999999995e-16 * T))) - -4.6623957000000009e+03 / T);
+  }
+
+  k[215] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.0212442240000001e+00 + 1.0904884300000002e+00 * logT + T * (1.1758385753526663e-03 + T * (-2.0742519119993201e-06 + T * (1.1162772880250682e-09 + -2.3635927699638663e-13 * T))) - -3.4688218280000001e+04 / T);
+  } else {
+    Kc = (-4.9645291039999995e+00 + 1.7334970300000001e+00 * logT + T * (-1.7640083935421484e-03 + T * (3.1626093535936570e-07 + T * (-4.0439142277929365e-11 + 2.3509941199098679e-15 * T))) - -3.4657097480000004e+04 / T);
+  }
+
+  k[216] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.6293251000000240e-02 + -2.0288643999999900e-01 * logT + T * (1.3582802849999998e-03 + T * (-1.7571746283333335e-06 + T * (9.8237418033333331e-10 + -2.1596610345000000e-13 * T))) - -9.4070685439999987e+04 / T);
+  } else {
+    Kc = (-1.4688769999999991e+00 + 1.7460184000000023e-01 * logT + T * (-9.4976421999999985e-04 + T * (2.6783130833333326e-07 + T * (-4.1197127833333337e-11 + 2.6049371749999998e-15 * T))) - -9.3993711479999998e+04 / T);
+  }
+
+  k[217] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.6133350359999996e+00 + -3.6934482999999974e-01 * logT + T * (-1.8014774046473331e-03 + T * (2.8292345596673468e-06 + T * (-1.6950186531415987e-09 + 3.9884137895361337e-13 * T))) - -7.6602224269999970e+03 / T);
+  } else {
+    Kc = (3.4555103860000003e+00 + -8.4359988999999969e-01 * logT + T * (1.3167082250078515e-03 + T * (-2.4578012864063416e-07 + T * (2.9778752772070638e-11 + -1.6384670000901322e-15 * T))) - -7.7265965780000042e+03 / T);
+  }
+
+  k[218] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.7959017949999989e+00 + -1.6818488499999997e+00 * logT + T * (-5.4139323050000007e-03 + T * (8.4151251983333340e-06 + T * (-4.9087132058333330e-09 + 1.1210072129999999e-12 * T))) - -4.5845855199999991e+04 / T);
+  } else {
+    Kc = (4.4454135099999998e+00 + -2.5363230000000003e+00 * logT + T * (3.6305123950000004e-03 + T * (-6.9816939366666658e-07 + T * (8.8403903083333326e-11 + -4.9954341350000000e-15 * T))) - -4.6296577300000004e+04 / T);
+  }
+
+  k[219] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.2281957739999996e+00 + -1.4129930300000000e+00 * logT + T * (-3.6074300146473337e-03 + T * (7.1893080730006792e-06 + T * (-4.6332951031415987e-09 + 1.1250716294536134e-12 * T))) - -3.6378379270000005e+04 / T);
+  } else {
+    Kc = (-7.2062421239999983e+00 + -4.1644970000000114e-02 * logT + T * (1.3748141684578521e-03 + T * (-2.8528603064063429e-07 + T * (3.8219881772070655e-11 + -2.2509492300901323e-15 * T))) - -3.7288037960000001e+04 / T);
+  }
+
+  k[220] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0620850826999998e+01 + -2.0012994399999995e+00 * logT + T * (1.0029748245000001e-02 + T * (-7.6587641633333328e-06 + T * (3.4516761591666673e-09 + -6.7624141450000000e-13 * T))) - -7.3601710999999959e+03 / T);
+  } else {
+    Kc = (-1.2308221634999999e+01 + 2.2045455250000003e+00 * logT + T * (-1.7835161650000004e-03 + T * (2.9508176666666667e-07 + T * (-3.7455171833333327e-11 + 2.1177993849999999e-15 * T))) - -7.9064865100000025e+03 / T);
+  }
+
+  k[221] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.8385900630000007e+00 + 1.8178789900000001e+00 * logT + T * (-8.5683349750000012e-03 + T * (6.2049026033333328e-06 + T * (-2.7327125521666666e-09 + 5.2366964395000012e-13 * T))) - -3.0777889299999995e+04 / T);
+  } else {
+    Kc = (1.2250493990000001e+01 + -1.6736230200000002e+00 * logT + T * (1.0961358100000001e-03 + T * (-1.9911339849999993e-07 + T * (2.4589078333333314e-11 + -1.3785141350000008e-15 * T))) - -3.0314538400000005e+04 / T);
+  }
+
+  k[222] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.9240423270000004e+00 + -5.0997294999999987e-01 * logT + T * (2.8462598599999995e-03 + T * (-2.1220486233333338e-06 + T * (8.9591278833333403e-10 + -1.6084833649999997e-13 * T))) - -9.6879854999999952e+03 / T);
+  } else {
+    Kc = (-2.6760605199999992e+00 + 8.7645422000000028e-01 * logT + T * (-8.5199074999999999e-04 + T * (1.7805266833333338e-07 + T * (-2.3680373000000011e-11 + 1.3808755549999997e-15 * T))) - -9.8665021999999990e+03 / T);
+  }
+
+  k[223] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.2123446059999999e+01 + -2.1815756600000000e+00 * logT + T * (2.4615292849999998e-03 + T * (-5.9933076833333345e-07 + T * (2.5389725833333334e-10 + -7.9965800000000011e-14 * T))) - 1.4719805059999999e+04 / T);
+  } else {
+    Kc = (-6.9913536600000006e+00 + 7.7196422000000009e-01 * logT + T * (-4.6873251184999980e-04 + T * (1.8844576798333333e-07 + T * (-3.5060823241666667e-11 + 2.4244697855000003e-15 * T))) - 1.3658285039999999e+04 / T);
+  }
+
+  k[224] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.0930444379999997e+00 + 1.3296918199999999e+00 * logT + T * (-5.6619343999999997e-03 + T * (4.3937364400000000e-06 + T * (-2.1047658408333332e-09 + 4.3768970950000006e-13 * T))) - -2.6074931380000005e+04 / T);
+  } else {
+    Kc = (4.9143938299999999e+00 + -7.1467780999999997e-01 * logT + T * (5.1272131300000021e-04 + T * (-9.1828792166666618e-08 + T * (9.4425637833333320e-12 + -4.1285538000000041e-16 * T))) - -2.5824301879999999e+04 / T);
+  }
+
+  k[225] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.4662274299999982e+00 + 1.5019710499999999e+00 * logT + T * (-9.9441143215000007e-03 + T * (7.9790933900000003e-06 + T * (-3.6918697041666675e-09 + 7.3966229350000022e-13 * T))) - -8.6942562600000019e+03 / T);
+  } else {
+    Kc = (1.3184849915000001e+01 + -2.3586581749999995e+00 * logT + T * (1.7412747600000001e-03 + T * (-2.4633008500000000e-07 + T * (3.0858424166666669e-11 + -1.8549906800000005e-15 * T))) - -8.2702844769999974e+03 / T);
+  }
+
+  k[226] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.5134503800000001e+00 + -2.0557558800000004e+00 * logT + T * (-4.7617231000000003e-03 + T * (8.0805652800000013e-06 + T * (-4.7586900000000002e-09 + 1.0890431210000001e-12 * T))) - -4.4412203099999999e+04 / T);
+  } else {
+    Kc = (1.6550210599999993e+00 + -2.4995539400000002e+00 * logT + T * (3.6027334800000001e-03 + T * (-6.7521995666666668e-07 + T * (8.5229226833333329e-11 + -4.8286005599999995e-15 * T))) - -4.4977561799999996e+04 / T);
+  }
+
+  k[227] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5921128470000006e+00 + -5.4071512000000066e-01 * logT + T * (-4.1042462096473340e-03 + T * (6.3756405963340138e-06 + T * (-3.8475260081415982e-09 + 8.9815928595361339e-13 * T))) - 5.4252887999999966e+03 / T);
+  } else {
+    Kc = (-3.8276131840000005e+00 + -1.1677901000000013e-01 * logT + T * (1.4587357184578523e-03 + T * (-3.3462995064063426e-07 + T * (4.6733966438737300e-11 + -2.8105348350901316e-15 * T))) - 4.7800113000000019e+03 / T);
+  }
+
+  k[228] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.9664645999999983e+00 + 8.3463335999999932e-01 * logT + T * (-6.5241794550000001e-03 + T * (5.1144518450000005e-06 + T * (-2.2818094305000006e-09 + 4.4417125555000006e-13 * T))) - -4.4875297359999997e+04 / T);
+  } else {
+    Kc = (1.0245444005000000e+01 + -2.2678549950000004e+00 * logT + T * (1.6283092500000002e-03 + T * (-2.1001404183333323e-07 + T * (2.2344327999999998e-11 + -1.1056845550000002e-15 * T))) - -4.4407719440000001e+04 / T);
+  }
+
+  k[229] = exp(Kc);
+
+  k[230] = exp(8.6305218767232414e+00 + 2.0 * logT - (6.0386347783099527e+03 / T));
+  k[231] = exp(2.4783708847492832e+01 - (2.8985446935887774e+02 / T));
+  k[232] = exp(2.5405397064070630e+01 - (1.5650128467119962e+03 / T));
+  k[233] = exp(2.2465484860614328e+01 - (-3.7993077146866790e+02 / T));
+  k[234] = exp(2.5970289909106896e+01 - (7.9468433682558980e+03 / T));
+  k[235] = exp(2.5272923313004245e+01 - (-2.5915807590246879e+02 / T));
+  k[236] = exp(2.2332703749380510e+01 - (7.5482934728874409e+02 / T));
+  k[237] = exp(6.2146080984221914e+00 + 2.0 * logT - (3.6382774539317465e+03 / T));
+  k[238] = exp(2.8101024745174282e+01 - (6.0104544826778401e+03 / T));
+  k[239] = exp(7.8079166289264084e+00 + 2.0 * logT - (4.1616258013852757e+03 / T));
+  k[240] = exp(2.0512544805630757e+01 + 0.5 * logT - (2.2695202375148242e+03 / T));
+  k[241] = exp(2.3431316038048621e+01 - (3.0193173891549765e+02 / T));
+  k[242] = exp(2.2920490414282632e+01 - (3.0193173891549765e+02 / T));
+  k[243] = exp(3.3808965229979151e+01 - 1.16 * logT - (5.7618640176374140e+02 / T));
+  k[244] = exp(2.3208172486734412e+01 - (-2.8683515196972274e+02 / T));
+  k[245] = exp(2.3495854559186192e+01 - (-2.8683515196972274e+02 / T));
+  k[246] = exp(2.4412145291060348e+01 - (-2.7677076067253950e+02 / T));
+  k[247] = exp(2.4295611474804396e+01 - (1.5338132336907280e+04 / T));
+  k[248] = exp(2.1560513361480112e+01 - (1.0222905460113891e+04 / T));
+  k[249] = exp(3.1986731175506815e+00 + 2.47 * logT - (2.6066773459704632e+03 / T));
+  k[250] = exp(3.1846107295846778e+01 - 1.18 * logT - (3.2910559541789246e+02 / T));
+  k[251] = exp(2.2646053568580871e+01 + 0.1 * logT - (5.3341273875071247e+03 / T));
+  if (T <= 1000.0) {
+    Kc = (-4.3580569799999989e+00 + 9.0374842000000033e-01 * logT + T * (-4.5087610900000005e-03 + T * (3.3179641900000010e-06 + T * (-1.4157509625000007e-09 + 2.6429808549999996e-13 * T))) - -8.5431247399999993e+03 / T);
+  } else {
+    Kc = (7.2986500549999995e+00 + -1.1993819250000000e+00 * logT + T * (9.5400038499999975e-04 + T * (-1.3459710166666672e-07 + T * (1.7499196999999999e-11 + -1.0032548849999998e-15 * T))) - -8.2361784399999997e+03 / T);
+  }
+
+  k[252] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1064734800000009e+00 + -3.7522091000000035e-01 * logT + T * (2.5728526950000007e-03 + T * (-2.6435927083333344e-06 + T * (1.5853632791666661e-09 + -3.8200293800000005e-13 * T))) - -4.2427944700000007e+03 / T);
+  } else {
+    Kc = (1.5732245050000007e+00 + -3.0790844500000003e-01 * logT + T * (3.5149254999999966e-04 + T * (-2.1952910000000029e-08 + T * (2.7303743333333360e-12 + -1.4474953500000150e-16 * T))) - -4.1115604600000006e+03 / T);
+  }
+
+  k[253] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0543313230000003e+01 + -2.1329060900000005e+00 * logT + T * (3.3827886749999998e-03 + T * (-2.7426336933333337e-06 + T * (1.8416603791666656e-09 + -4.9670607699999980e-13 * T))) - -7.0279700000002777e+01 / T);
+  } else {
+    Kc = (-1.3857659549999983e+00 + -2.2977513500000035e-01 * logT + T * (-3.5642934999999092e-05 + T * (1.6048495666666665e-07 + T * (-3.0002253666666656e-11 + 2.0417134700000000e-15 * T))) - -7.4122166999999899e+02 / T);
+  }
+
+  k[254] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.5622094999999989e+00 + 7.2955069999999989e-01 * logT + T * (-3.2983082300000002e-03 + T * (2.0452922233333329e-06 + T * (-6.8416981250000110e-10 + 9.2609412999999793e-14 * T))) - 3.0784244699999981e+03 / T);
+  } else {
+    Kc = (8.6694540750000009e+00 + -1.2302533850000001e+00 * logT + T * (9.1793021500000040e-04 + T * (-1.1929315833333311e-07 + T * (1.4387029666666653e-11 + -7.8272168499999913e-16 * T))) - 3.4290588700000008e+03 / T);
+  }
+
+  k[255] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.6968084999999977e+00 + 1.4913264899999996e+00 * logT + T * (-7.1834883850000007e-03 + T * (5.5367155399999999e-06 + T * (-2.5557633708333330e-09 + 5.1539307800000005e-13 * T))) - -2.3278143999999993e+03 / T);
+  } else {
+    Kc = (9.6321611149999988e+00 + -1.3280913050000001e+00 * logT + T * (9.3152541500000040e-04 + T * (-1.1702909833333329e-07 + T * (1.3774798833333336e-11 + -7.3692383000000025e-16 * T))) - -1.9600156899999965e+03 / T);
+  }
+
+  k[256] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.1909936329999997e+00 + 8.5834762999999947e-01 * logT + T * (1.3167858203526664e-03 + T * (-2.1271883786659866e-06 + T * (1.1851179321917346e-09 + -2.6210565749638660e-13 * T))) - 7.2900089399999997e+03 / T);
+  } else {
+    Kc = (-4.8693513540000000e+00 + 1.4430112399999997e+00 * logT + T * (-1.4472139265421485e-03 + T * (2.4760506252603246e-07 + T * (-2.9925731227929364e-11 + 1.6493049999098680e-15 * T))) - 7.3098693499999972e+03 / T);
+  }
+
+  k[257] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.9533429000000044e-01 + -1.2231072000000021e-01 * logT + T * (4.4059264500000009e-04 + T * (-2.4202386333333343e-07 + T * (-3.1139927166666694e-11 + 4.0320486050000086e-14 * T))) - -1.6824899359999999e+04 / T);
+  } else {
+    Kc = (-4.3254706300000008e+00 + 6.7768429000000019e-01 * logT + T * (-1.0688476199999998e-03 + T * (2.6832314633333334e-07 + T * (-3.7861079583333334e-11 + 2.1933512700000002e-15 * T))) - -1.6963476116999998e+04 / T);
+  }
+
+  k[258] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.2603984300000004e+00 + 1.4491756199999997e+00 * logT + T * (-8.6287215400000002e-03 + T * (7.1167116633333333e-06 + T * (-3.5058682675000000e-09 + 7.4280576450000006e-13 * T))) - -9.7562914300000011e+03 / T);
+  } else {
+    Kc = (7.3750642600000020e+00 + -1.1973025499999999e+00 * logT + T * (6.5548271999999960e-04 + T * (-9.1211401833333269e-08 + T * (1.0329441583333326e-11 + -6.3246090000000046e-16 * T))) - -9.5530115970000006e+03 / T);
+  }
+
+  k[259] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.5697238179999999e+01 + 3.2068607999999998e+00 * logT + T * (-9.4386575199999993e-03 + T * (7.2157526483333326e-06 + T * (-3.7621653674999999e-09 + 8.5750890350000011e-13 * T))) - -1.3928806200000001e+04 / T);
+  } else {
+    Kc = (1.0334054720000001e+01 + -1.2754358599999991e+00 * logT + T * (1.0426182050000002e-03 + T * (-2.7364926849999991e-07 + T * (4.3062069583333335e-11 + -2.8189239050000005e-15 * T))) - -1.2923350387000000e+04 / T);
+  }
+
+  k[260] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.1064640199999998e+00 + 1.1286056200000005e+00 * logT + T * (-7.1337529699999997e-03 + T * (5.5710678366666671e-06 + T * (-2.6837677355000001e-09 + 5.5613434404999995e-13 * T))) - -7.6279970679999999e+04 / T);
+  } else {
+    Kc = (6.4908909699999997e+00 + -9.6298437000000003e-01 * logT + T * (3.9208806500000003e-04 + T * (-1.4790741033333341e-07 + T * (2.5462831583333343e-11 + -1.7160293150000001e-15 * T))) - -7.6172561530000006e+04 / T);
+  }
+
+  k[261] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.5123549849999982e+00 + -1.9253073560000000e+00 * logT + T * (9.8554052535266765e-04 + T * (2.0729865996673473e-06 + T * (-1.8017558498082654e-09 + 4.9042694845361333e-13 * T))) - -1.4018817427000002e+04 / T);
+  } else {
+    Kc = (-5.2503194940000011e+00 + 1.4248393000000048e-01 * logT + T * (6.2942503500785152e-04 + T * (-1.7242241864063422e-07 + T * (2.8565692355403975e-11 + -1.9212890700901320e-15 * T))) - -1.4761246978000003e+04 / T);
+  }
+
+  k[262] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0191016829999999e+01 + 2.0199861800000010e+00 * logT + T * (-5.8351582350000004e-03 + T * (2.5556170316666676e-06 + T * (-4.8298796750000010e-10 + -2.2193090999999984e-14 * T))) - -4.4265294979999999e+04 / T);
+  } else {
+    Kc = (1.1980510229999997e+01 + -1.7663973799999999e+00 * logT + T * (1.1718196699999992e-03 + T * (-2.4470901683333352e-07 + T * (3.0705871916666657e-11 + -1.6901975800000010e-15 * T))) - -4.3508330329999997e+04 / T);
+  }
+
+  k[263] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1331573643999999e+01 + -1.8061892659999998e+00 * logT + T * (1.9456303059999999e-02 + T * (-1.8682393616666667e-05 + T * (9.7776106999999999e-09 + -2.1432642325000001e-12 * T))) - 2.0421269596999999e+04 / T);
+  } else {
+    Kc = (-2.0189411500000002e+01 + 4.4487376800000007e+00 * logT + T * (-4.3665754665500002e-03 + T * (8.0621456799999991e-07 + T * (-9.8698621083333359e-11 + 5.4804038649999998e-15 * T))) - 2.0045954138000001e+04 / T);
+  }
+
+  k[264] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.2296901000000036e-01 + 1.7207745000000019e-01 * logT + T * (-2.5681599500000001e-03 + T * (3.1159559316666656e-06 + T * (-1.9867757508333335e-09 + 4.9930298850000008e-13 * T))) - -6.3930989700000009e+03 / T);
+  } else {
+    Kc = (-5.6413219399999974e+00 + 8.1612780000000029e-01 * logT + T * (-9.9756225500000051e-04 + T * (2.3259934149999995e-07 + T * (-3.1264320416666639e-11 + 1.7408220449999998e-15 * T))) - -6.7173194270000004e+03 / T);
+  }
+
+  k[265] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4352104238000001e+01 + 4.1169046099999989e+00 * logT + T * (-9.1401558600000005e-03 + T * (3.4222276766666667e-06 + T * (-8.0513212266666674e-10 + 6.8900921600000050e-14 * T))) - -4.4068596879999997e+04 / T);
+  } else {
+    Kc = (1.8978584500000000e+01 + -1.3874847500000005e+00 * logT + T * (-4.4747153199999968e-04 + T * (8.0045842499999932e-08 + T * (-1.0297601216666666e-11 + 6.0456528999999955e-16 * T))) - -4.2683845079999999e+04 / T);
+  }
+
+  k[266] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.4886155739999989e+00 + 2.4643052339999993e+00 * logT + T * (-6.5845932300000014e-03 + T * (2.3291081933333327e-06 + T * (-3.9352187766666722e-10 + -8.8308268999998846e-15 * T))) - -4.2378089300000007e+04 / T);
+  } else {
+    Kc = (2.3946083969999997e+01 + -2.6784707399999999e+00 * logT + T * (9.5802064999999997e-04 + T * (-1.9728177700000007e-07 + T * (2.9583095583333331e-11 + -1.9018700250000003e-15 * T))) - -4.1022175600000010e+04 / T);
+  }
+
+  k[267] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.2091744000000002e-01 + -2.5153219999999976e-01 * logT + T * (1.3839487800000002e-03 + T * (-1.3935300066666667e-06 + T * (7.3746534666666676e-10 + -1.5678856450000000e-13 * T))) - -3.7847900699999998e+04 / T);
+  } else {
+    Kc = (-7.3557940000001043e-02 + -1.8048771999999991e-01 * logT + T * (1.8003868149999978e-05 + T * (3.6111048166666623e-09 + T * (-7.2760949166666715e-13 + 2.7234700500000002e-17 * T))) - -3.7759966199999995e+04 / T);
+  }
+
+  k[268] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.6230916099999995e+00 + 1.1042870400000004e+00 * logT + T * (-2.4607803399999996e-03 + T * (1.3061306583333336e-06 + T * (-4.8190887916666673e-10 + 8.3625417000000004e-14 * T))) - -1.6073811240000003e+04 / T);
+  } else {
+    Kc = (9.1925481000000087e-01 + 1.3154564000000013e-01 * logT + T * (-2.7642400185000002e-04 + T * (8.1628056316666668e-08 + T * (-1.5021409241666664e-11 + 1.0451302304999998e-15 * T))) - -1.5906761580000006e+04 / T);
+  }
+
+  k[269] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.4822805649999991e+00 + 2.2646086999999993e-01 * logT + T * (-1.1188292396473339e-03 + T * (1.0705139313340135e-06 + T * (-4.5458350564159866e-10 + 7.1973114953613397e-14 * T))) - -2.4401434660000003e+04 / T);
+  } else {
+    Kc = (-3.4554609539999990e+00 + 2.5177503999999962e-01 * logT + T * (2.3389195545785136e-04 + T * (-7.2775333640634211e-08 + T * (1.0598131238737304e-11 + -6.8693744009013213e-16 * T))) - -2.4597795500000000e+04 / T);
+  }
+
+  k[270] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.8575937899999992e+00 + 1.6557160600000000e+00 * logT + T * (-4.8069514600000002e-03 + T * (2.1520558416666665e-06 + T * (-6.3280787083333342e-10 + 8.0846643000000009e-14 * T))) - -3.9948877059999999e+04 / T);
+  } else {
+    Kc = (1.0034457189999999e+01 + -1.1833158400000001e+00 * logT + T * (2.1500667685000010e-04 + T * (-6.8313731316666671e-08 + T * (1.3370966241666664e-11 + -9.9391185050000003e-16 * T))) - -3.9302239319999993e+04 / T);
+  }
+
+  k[271] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.1259767960000000e+01 + 3.0115353000000002e+00 * logT + T * (-8.6516805800000013e-03 + T * (4.8517165066666658e-06 + T * (-1.8521820966666668e-09 + 3.2126062450000001e-13 * T))) - -1.8174787600000003e+04 / T);
+  } else {
+    Kc = (1.1027269940000000e+01 + -8.7128248000000008e-01 * logT + T * (-7.9421193149999993e-05 + T * (9.7032201833333148e-09 + T * (-9.2283350833333174e-13 + 2.3983679500000015e-17 * T))) - -1.7449034700000000e+04 / T);
+  }
+
+  k[272] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.9984048350000005e+00 + 2.5335422300000001e+00 * logT + T * (-6.1489025603526665e-03 + T * (2.3876725686659865e-06 + T * (-6.6013324435840145e-10 + 9.2498945046386616e-14 * T))) - -3.1621253640000003e+04 / T);
+  } else {
+    Kc = (1.4409172953999999e+01 + -1.3035452399999996e+00 * logT + T * (-2.9530928045785128e-04 + T * (8.6089658640634181e-08 + T * (-1.2248574238737303e-11 + 7.3815582009013220e-16 * T))) - -3.0611205399999999e+04 / T);
+  }
+
+  k[273] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.3383414719999998e+00 + 1.3513093799999996e+00 * logT + T * (-6.1221452950000000e-03 + T * (4.3747412816666657e-06 + T * (-2.0363101391666670e-09 + 4.2070003700000005e-13 * T))) - -1.3082946820000001e+04 / T);
+  } else {
+    Kc = (8.4627644200000010e+00 + -9.7210966999999915e-01 * logT + T * (2.7617105700000017e-04 + T * (-6.1688439666666672e-08 + T * (1.1929648800000002e-11 + -9.7551058999999984e-16 * T))) - -1.2743002786999999e+04 / T);
+  }
+
+  k[274] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.9654804400000003e+00 + 3.2097939000000002e+00 * logT + T * (-6.5879032200000000e-03 + T * (2.7251934933333331e-06 + T * (-8.4737765333333335e-10 + 1.2992619550000000e-13 * T))) - 1.9359584900000002e+04 / T);
+  } else {
+    Kc = (1.2293599459999999e+01 + -3.2701211999999957e-01 * logT + T * (-6.1251120684999996e-04 + T * (7.1996866483333315e-08 + T * (-5.7545433249999993e-12 + 2.1251081050000004e-16 * T))) - 2.0221376600000000e+04 / T);
+  }
+
+  k[275] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.9478507199999937e-01 + -5.8422767999999969e-01 * logT + T * (2.7006749950000001e-03 + T * (-1.8205934483333328e-06 + T * (7.7133045583333352e-10 + -1.4483285700000006e-13 * T))) - -3.6277325799999994e+03 / T);
+  } else {
+    Kc = (-6.4949510699999990e+00 + 6.9982536999999967e-01 * logT + T * (-3.5504955700000002e-04 + T * (6.0210799666666659e-08 + T * (-9.5145912166666687e-12 + 8.0274029999999995e-16 * T))) - -3.8576760129999993e+03 / T);
+  }
+
+  k[276] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.4219240400000004e+00 + -2.4427122000000003e+00 * logT + T * (3.1664329199999996e-03 + T * (-1.7104566000000018e-07 + T * (-4.1760202999999983e-10 + 1.4594098449999999e-13 * T))) - -3.6070264300000003e+04 / T);
+  } else {
+    Kc = (-1.0325786109999999e+01 + 5.4727819999999650e-02 * logT + T * (5.3363270685000000e-04 + T * (-7.3474506483333341e-08 + T * (8.1696009083333325e-12 + -3.8528110049999998e-16 * T))) - -3.6822055399999997e+04 / T);
+  }
+
+  k[277] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.3140373899999997e+00 + 8.8863435999999973e-01 * logT + T * (-1.3854811599999998e-03 + T * (-4.0209199166666680e-07 + T * (6.3217181249999985e-10 + -1.9502053699999998e-13 * T))) - -2.3238197660000002e+04 / T);
+  } else {
+    Kc = (8.0666438400000011e+00 + -9.1103154000000020e-01 * logT + T * (2.9388517685000016e-04 + T * (-6.6836091316666672e-08 + T * (1.0955908658333331e-11 + -8.2114156050000004e-16 * T))) - -2.2701560519999999e+04 / T);
+  }
+
+  k[278] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.4548484350000006e+00 + 1.7664605299999998e+00 * logT + T * (-2.7274322603526666e-03 + T * (-1.6647526466734673e-07 + T * (6.0484643897493183e-10 + -1.8336823495361339e-13 * T))) - -1.4910574240000000e+04 / T);
+  } else {
+    Kc = (1.2441359604000001e+01 + -1.0312609399999997e+00 * logT + T * (-2.1643078045785133e-04 + T * (8.7567298640634207e-08 + T * (-1.4663631822070636e-11 + 9.1092611009013200e-16 * T))) - -1.4010526600000001e+04 / T);
+  }
+
+  k[279] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.1233984129999994e+00 + 5.7300699999999871e-02 * logT + T * (-8.3572456964733379e-04 + T * (9.8116773966734676e-07 + T * (-4.7414277980826538e-10 + 8.6330699453613401e-14 * T))) - -3.5684605300000003e+04 / T);
+  } else {
+    Kc = (-5.0099907839999984e+00 + 4.0749202999999978e-01 * logT + T * (-2.6382304692148715e-05 + T * (-7.7230754573008623e-09 + T * (9.3911930403971195e-14 + 1.2125034409867917e-17 * T))) - -3.5943792600000001e+04 / T);
+  }
+
+  k[280] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.6238513709999998e+00 + -1.1485773799999999e+00 * logT + T * (3.8343643846473329e-03 + T * (-2.9981837663340132e-06 + T * (1.4729637664749321e-09 + -3.1702104545361340e-13 * T))) - -1.2167587072999999e+04 / T);
+  } else {
+    Kc = (-4.3190399859999999e+00 + 4.6952929000000010e-01 * logT + T * (-6.0217740000785135e-04 + T * (1.3420225697396753e-07 + T * (-1.8974053772070638e-11 + 1.1746942950901323e-15 * T))) - -1.2410893821999995e+04 / T);
+  }
+
+  k[281] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0188835000000784e-02 + -4.5143233000000027e-01 * logT + T * (-1.7900457796473333e-03 + T * (2.5573861646673468e-06 + T * (-1.3114670723082653e-09 + 2.6085196495361340e-13 * T))) - -8.4737526599999983e+03 / T);
+  } else {
+    Kc = (-1.6604565539999987e+00 + -3.9732956000000019e-01 * logT + T * (8.0806658045785146e-04 + T * (-8.1203753640634200e-08 + T * (5.5897703220706377e-12 + -3.2150746309013219e-16 * T))) - -8.7552630999999965e+03 / T);
+  }
+
+  k[282] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.3867575199999997e+00 + -7.8628336999999959e-01 * logT + T * (2.6545719999999966e-05 + T * (5.6525201666666672e-07 + T * (-3.4070679083333331e-10 + 7.2178008500000003e-14 * T))) - -1.9684799260000000e+04 / T);
+  } else {
+    Kc = (-1.7445122000000035e-01 + -4.2664507999999968e-01 * logT + T * (2.3676798700000010e-04 + T * (2.5298390000000084e-09 + T * (-4.7681739499999993e-12 + 4.2736052000000001e-16 * T))) - -1.9850029100000000e+04 / T);
+  }
+
+  k[283] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.1306222099999994e+00 + 4.2639383999999980e-01 * logT + T * (-3.1319968799999997e-03 + T * (2.7930028916666668e-06 + T * (-1.3387924458333333e-09 + 2.7250426700000000e-13 * T))) - -1.4612924000000203e+02 / T);
+  } else {
+    Kc = (2.7142592100000007e+00 + -5.1755895999999968e-01 * logT + T * (2.9775062315000008e-04 + T * (7.3199636316666652e-08 + T * (-2.0029770158333330e-11 + 1.4105602075000001e-15 * T))) - -6.4229180000002088e+01 / T);
+  }
+
+  k[284] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-4.2642094580000007e+00 + 9.3512686999999994e-01 * logT + T * (-2.1776756700000004e-03 + T * (1.2167844666666667e-06 + T * (-5.0146815333333330e-10 + 9.7983001500000008e-14 * T))) - -2.7356981879999999e+04 / T);
+  } else {
+    Kc = (-6.3527501999999947e-01 + 2.8726263000000030e-01 * logT + T * (-5.3669826199999999e-04 + T * (1.4668031449999999e-07 + T * (-2.5525628550000000e-11 + 1.7441927050000000e-15 * T))) - -2.7252758679999999e+04 / T);
+  }
+
+  k[285] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.3443158529999994e+00 + -1.9423149999999989e-01 * logT + T * (5.4822421035266632e-04 + T * (-4.1236226699931982e-07 + T * (2.6332256685840138e-10 + -7.0457865046386596e-14 * T))) - -7.3532506000000008e+04 / T);
+  } else {
+    Kc = (-5.0835487239999999e+00 + 2.2700430999999988e-01 * logT + T * (-8.3784365421486415e-06 + T * (-4.1119706406342066e-09 + T * (-6.3369756126269636e-13 + 3.9359734909867919e-17 * T))) - -7.3703758799999996e+04 / T);
+  }
+
+  k[286] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.2472826860000001e+00 + -8.1372634000000055e-01 * logT + T * (2.0177728849999996e-03 + T * (-1.0060496183333333e-06 + T * (5.0220348500000010e-10 + -1.2834708900000004e-13 * T))) - -9.5654047300000093e+02 / T);
+  } else {
+    Kc = (-5.8050453199999987e+00 + 4.9884480999999958e-01 * logT + T * (-3.0878806550000098e-05 + T * (5.0468664333333311e-08 + T * (-8.6161095000000015e-12 + 4.2582631200000002e-16 * T))) - -1.3161278219999949e+03 / T);
+  }
+
+  k[287] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.3796471199999938e-01 + -4.2069236999999982e-01 * logT + T * (1.6670534500000001e-03 + T * (-1.4828761983333330e-06 + T * (7.1790607249999988e-10 + -1.4243097999999998e-13 * T))) - -4.9131071340000002e+04 / T);
+  } else {
+    Kc = (-1.6280877700000009e+00 + -2.4770729999999741e-02 * logT + T * (-2.4227039200000000e-04 + T * (6.8663362999999991e-08 + T * (-1.1231828800000000e-11 + 7.2629717500000000e-16 * T))) - -4.9105963299999996e+04 / T);
+  }
+
+  k[288] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.1363695469999993e+00 + -2.9542345999999999e+00 * logT + T * (7.8159560103526673e-03 + T * (-3.8705487669993199e-06 + T * (1.3780393168584015e-09 + -2.3492992504638663e-13 * T))) - -1.7509817700000000e+04 / T);
+  } else {
+    Kc = (-1.6037260723999999e+01 + 1.2787745099999999e+00 * logT + T * (5.3038888457851278e-05 + T * (-1.7426295640634190e-08 + T * (1.0167454387373029e-12 + -1.1858645090132098e-17 * T))) - -1.8494757899999997e+04 / T);
+  }
+
+  k[289] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.7834256799999957e-01 + 1.1265392999999957e-01 * logT + T * (1.6479659000000000e-03 + T * (-1.7701681250000003e-06 + T * (8.6167473416666670e-10 + -1.7141567050000001e-13 * T))) - -5.5124596400000009e+03 / T);
+  } else {
+    Kc = (-1.5596965299999992e+00 + 4.7241758999999961e-01 * logT + T * (-6.2153068514999991e-04 + T * (9.8947389849999999e-08 + T * (-1.1384117058333335e-11 + 6.4645340450000000e-16 * T))) - -5.4100311000000002e+03 / T);
+  }
+
+  k[290] = exp(Kc);
+
+  k[291] = exp(1.1999647829283970e+00 + 2.81 * logT - (2.9488666500746936e+03 / T));
+  k[292] = exp(1.0308952660644293e+01 + 1.5 * logT - (5.0020024747000780e+03 / T));
+  k[293] = exp(9.2103403719761836e+00 + 1.5 * logT - (5.0020024747000780e+03 / T));
+  k[294] = exp(5.4249500174814029e+00 + 2.0 * logT - (4.6296199967042976e+03 / T));
+  k[295] = exp(8.7225800211411890e+00 + 1.74 * logT - (5.2586444527782505e+03 / T));
+  k[296] = exp(3.4944241503018851e+01 - 1.0 * logT - (8.5547326026057672e+03 / T));
+  k[297] = exp(3.2862129732783131e+01 - 1.0 * logT - (8.5547326026057672e+03 / T));
+  k[298] = exp(2.3322244942994260e+01 - (2.0128782594366510e+02 / T));
+  k[299] = exp(2.3613637594842576e+01 - (4.5289760837324650e+02 / T));
+  k[300] = exp(-3.5387408478311023e+01 + 7.6 * logT - (-1.7763650639528446e+03 / T));
+  k[301] = exp(2.3025850929940457e+01 - (-3.7993077146866790e+02 / T));
+  k[302] = exp(1.7855046883691379e+01 + 0.9 * logT - (1.0029165927643113e+03 / T));
+  k[303] = exp(3.1455305207048688e+01 - 1.39 * logT - (5.1076785833205020e+02 / T));
+  k[304] = exp(2.9710462657608385e+01 + 0.44 * logT - (4.3664361642829550e+04 / T));
+  k[305] = exp(2.0548912449801634e+01 - (1.9499758138292557e+03 / T));
+  k[306] = exp(2.1886416646752092e+01 - (4.2974950838972501e+02 / T));
+  k[307] = exp(2.4019102702950740e+01 - (1.7864294552500277e+02 / T));
+  k[308] = exp(1.6012735135300492e+01 + 1.0 * logT - (3.2709271715845580e+03 / T));
+  k[309] = exp(2.4237791903915571e+01 - (1.9373953247077765e+02 / T));
+  k[310] = exp(2.1059738073567623e+01 - (5.4398034961275489e+03 / T));
+  k[311] = exp(2.4090561666932885e+01 - (1.1649532926489617e+04 / T));
+  k[312] = exp(2.6681690529976194e+01 - (9.5007853845409918e+03 / T));
+  k[313] = exp(2.1416413017506358e+01 - (1.0597804035933967e+04 / T));
+  k[314] = exp(2.5093978711720020e+01 - (2.8190360023410296e+04 / T));
+  k[315] = exp(2.1469953784434388e+01 - (-2.4154539113239812e+02 / T));
+  k[316] = exp(3.2294460210040619e+01 - 1.41 * logT);
+  k[317] = exp(2.2084242390082011e+01 - (-1.2077269556619906e+02 / T));
+  k[318] = exp(2.5606067759532781e+01 - (1.8115904334929860e+02 / T));
+  k[319] = exp(2.4189001739746139e+01 - (1.6606245640352370e+02 / T));
+  k[320] = exp(1.4508657738524219e+01 + 1.2 * logT);
+  k[321] = exp(6.1333980429966486e+00 + 2.0 * logT - (3.2709271715845580e+03 / T));
+  k[322] = exp(7.1546153569136628e+00 + 1.5 * logT - (5.0321956485916274e+01 / T));
+  k[323] = exp(2.3718998110500401e+01 - (6.9695909732994041e+03 / T));
+  k[324] = exp(2.3795959151636531e+01 - 0.23 * logT);
+  k[325] = exp(2.6623163190528903e+01 - 0.45 * logT);
+  if (T <= 1000.0) {
+    Kc = (-2.6815373299999923e-01 + -3.3877840000000026e-01 * logT + T * (-1.4207987964733309e-04 + T * (7.8721803966734651e-07 + T * (-4.4979233814159858e-10 + 8.9436294453613392e-14 * T))) - -1.3986212300000001e+04 / T);
+  } else {
+    Kc = (-3.2201530839999997e+00 + 7.5088029999999417e-02 * logT + T * (1.8653589530785134e-04 + T * (1.7743636209365799e-08 + T * (-5.7943467362626953e-12 + 3.2494594140986786e-16 * T))) - -1.4165294199999998e+04 / T);
+  }
+
+  k[326] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.9866266510000008e+00 + -8.6676327999999980e-01 * logT + T * (5.1992256146473331e-03 + T * (-4.6790056996673460e-06 + T * (2.3541977748082650e-09 + -5.0279430045361343e-13 * T))) - -6.3968760729999995e+03 / T);
+  } else {
+    Kc = (-4.3242066859999992e+00 + 7.8622988999999954e-01 * logT + T * (-9.6343382500785129e-04 + T * (1.6809738864063421e-07 + T * (-1.9853951522070637e-11 + 1.1220852250901322e-15 * T))) - -6.4749278219999978e+03 / T);
+  }
+
+  k[327] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.7495328000000014e+00 + -5.0446926999999908e-01 * logT + T * (1.3914069499999999e-03 + T * (-1.1155699166666667e-06 + T * (5.4052721750000006e-10 + -1.1359524649999998e-13 * T))) - -1.3914088259999997e+04 / T);
+  } else {
+    Kc = (-1.7961792000000010e-01 + -1.0994448000000023e-01 * logT + T * (-1.2448843799999995e-04 + T * (3.6424970666666698e-08 + T * (-5.6480716999999996e-12 + 3.7475144999999996e-16 * T))) - -1.3914063099999999e+04 / T);
+  }
+
+  k[328] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.2823615299999940e-01 + 4.5398429999999967e-01 * logT + T * (3.1289738003526663e-03 + T * (-4.0037801669993201e-06 + T * (2.2806649168584014e-09 + -5.1959039504638663e-13 * T))) - -4.3392130000000034e+03 / T);
+  } else {
+    Kc = (-5.9654722400000004e-01 + 6.5988560999999990e-01 * logT + T * (-7.0176571154214880e-04 + T * (7.8864336026032444e-08 + T * (-5.6212970612626955e-12 + 1.6692727490986784e-16 * T))) - -4.0998348000000015e+03 / T);
+  }
+
+  k[329] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5580917700000008e+00 + -5.2667405000000089e-01 * logT + T * (2.2527806249999999e-03 + T * (-2.1186156516666675e-06 + T * (1.0644070574999998e-09 + -2.1716425150000004e-13 * T))) - -2.8454121300000003e+04 / T);
+  } else {
+    Kc = (-5.2666499999999949e-02 + -1.0544133999999961e-01 * logT + T * (-3.2339940499999994e-04 + T * (9.9582419833333323e-08 + T * (-1.3556645416666662e-11 + 7.1097354499999995e-16 * T))) - -2.8373180267000000e+04 / T);
+  }
+
+  k[330] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.6116054799999961e-01 + -2.2226737000000085e-01 * logT + T * (3.5679744600000006e-03 + T * (-4.3413010916666667e-06 + T * (2.4679093258333334e-09 + -5.5701764549999998e-13 * T))) - -5.5320051539999993e+04 / T);
+  } else {
+    Kc = (1.5190262700000003e+00 + -3.1664750999999969e-01 * logT + T * (-3.8456378515000001e-04 + T * (9.2957128183333298e-08 + T * (-1.2115327975000001e-11 + 6.9257228450000005e-16 * T))) - -5.4932416800000006e+04 / T);
+  }
+
+  k[331] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0991252599999990e+00 + 1.9842499999999941e-01 * logT + T * (1.9009210099999998e-03 + T * (-2.8584248933333333e-06 + T * (1.7500032533333335e-09 + -4.1458666550000000e-13 * T))) - -6.1889802000000054e+03 / T);
+  } else {
+    Kc = (3.1471140400000013e+00 + -2.9187678000000039e-01 * logT + T * (-1.4229339315000001e-04 + T * (2.4293765183333320e-08 + T * (-8.8349917499999914e-13 + -3.3724890500000001e-17 * T))) - -5.8264535000000033e+03 / T);
+  }
+
+  k[332] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.3038086710000005e+00 + -1.2016845800000002e+00 * logT + T * (7.1192341746473334e-03 + T * (-7.2501386663340136e-06 + T * (3.9604323664749323e-09 + -8.8839627545361345e-13 * T))) - -5.6204467972999999e+04 / T);
+  } else {
+    Kc = (-1.2454838859999997e+00 + -2.8352100000001990e-03 * logT + T * (-7.2646692500785140e-04 + T * (1.6210712697396752e-07 + T * (-2.0585162438737304e-11 + 1.1682041050901321e-15 * T))) - -5.5997313522000004e+04 / T);
+  }
+
+  k[333] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.0667148200000014e+00 + -8.3939056999999950e-01 * logT + T * (3.3114155100000004e-03 + T * (-3.6867028833333326e-06 + T * (2.1467618091666670e-09 + -4.9919722149999996e-13 * T))) - -6.3721680159999996e+04 / T);
+  } else {
+    Kc = (2.8991048799999999e+00 + -8.9900957999999953e-01 * logT + T * (1.1247846199999995e-04 + T * (3.0434708999999984e-08 + T * (-6.3792826166666660e-12 + 4.2087033000000001e-16 * T))) - -6.3436448800000006e+04 / T);
+  }
+
+  k[334] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.7037071199999980e+00 + 4.3027002999999953e-01 * logT + T * (-4.7119914749999998e-03 + T * (3.2378600566666669e-06 + T * (-1.1862624458333336e-09 + 1.8668651799999997e-13 * T))) - -5.6504519299999993e+04 / T);
+  } else {
+    Kc = (1.4518248135000000e+01 + -3.0509806250000002e+00 * logT + T * (2.3737574650000001e-03 + T * (-3.7875476833333331e-07 + T * (4.6648762166666668e-11 + -2.5880622800000001e-15 * T))) - -5.5817423590000006e+04 / T);
+  }
+
+  k[335] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.1006628530000002e+00 + -1.1849847000000002e+00 * logT + T * (-5.1532055035266588e-04 + T * (1.2386975003326533e-06 + T * (-6.5007988352506800e-10 + 1.3709401504638660e-13 * T))) - -2.3769985900000000e+04 / T);
+  } else {
+    Kc = (5.4651077240000001e+00 + -1.7813547100000000e+00 * logT + T * (1.1516508115421487e-03 + T * (-5.9387886026032471e-08 + T * (-9.9817252207063742e-13 + 1.9201251209013214e-16 * T))) - -2.3644052499999998e+04 / T);
+  }
+
+  k[336] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.1335872480000004e+00 + 5.0873303000000014e-01 * logT + T * (9.5432120999999954e-04 + T * (-1.5762184250000001e-06 + T * (8.3732429250000000e-10 + -1.7452126549999997e-13 * T))) - -2.7210852640000001e+04 / T);
+  } else {
+    Kc = (-3.3495342299999997e+00 + 8.0482158999999998e-01 * logT + T * (-8.3444888515000007e-04 + T * (7.3480678183333338e-08 + T * (-5.4958583916666665e-12 + 3.3363249750000000e-16 * T))) - -2.7188529500000004e+04 / T);
+  }
+
+  k[337] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.1313819709999997e+00 + -4.7068417999999967e-01 * logT + T * (4.5055809246473330e-03 + T * (-4.4850559996673466e-06 + T * (2.3298473331415985e-09 + -5.0589989545361344e-13 * T))) - -2.8095269073000003e+04 / T);
+  } else {
+    Kc = (-6.1140443859999998e+00 + 1.1186338899999999e+00 * logT + T * (-1.1763520250078516e-03 + T * (1.4263067697396752e-07 + T * (-1.3965692855403972e-11 + 8.0926431809013212e-16 * T))) - -2.8253426222000002e+04 / T);
+  }
+
+  k[338] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0571187999999987e-01 + -1.0839016999999940e-01 * logT + T * (6.9776225999999960e-04 + T * (-9.2162021666666645e-07 + T * (5.1617677583333336e-10 + -1.1670084150000000e-13 * T))) - -3.5612481260000000e+04 / T);
+  } else {
+    Kc = (-1.9694556200000002e+00 + 2.2245952000000013e-01 * logT + T * (-3.3740663800000000e-04 + T * (1.0958258999999998e-08 + T * (2.4018696666666694e-13 + 6.1930543000000013e-17 * T))) - -3.5692561500000003e+04 / T);
+  }
+
+  k[339] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.8566506999999994e-01 + 2.0432635000000010e-01 * logT + T * (-3.6087262500000047e-04 + T * (6.4646701499999954e-07 + T * (-5.6617797583333357e-10 + 1.6533212850000007e-13 * T))) - -3.4492240000000118e+02 / T);
+  } else {
+    Kc = (-4.9212270000000000e+00 + 1.0160277600000005e+00 * logT + T * (-7.7328450500000010e-04 + T * (8.0105969833333324e-08 + T * (-6.9371758333333307e-12 + 3.5203375800000000e-16 * T))) - -6.2929296700000043e+02 / T);
+  }
+
+  k[340] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.3715537499999999e+00 + -7.0166873000000018e-01 * logT + T * (1.8122392150000000e-03 + T * (-1.2950912216666667e-06 + T * (6.1251961283333337e-10 + -1.2763903244999998e-13 * T))) - -3.9070048199999990e+04 / T);
+  } else {
+    Kc = (6.0814713499999993e+00 + -1.1842727700000002e+00 * logT + T * (1.1399707093500001e-03 + T * (-2.4280962665000002e-07 + T * (2.8245736574999998e-11 + -1.4021312004999999e-15 * T))) - -3.8771866500000004e+04 / T);
+  }
+
+  k[341] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.5052274350000010e+00 + -2.2780197300000000e+00 * logT + T * (6.0809997953526667e-03 + T * (-2.5248082519993201e-06 + T * (7.4983274685840136e-10 + -1.1155853204638663e-13 * T))) - -1.5167283659999994e+04 / T);
+  } else {
+    Kc = (-1.1067721453999999e+01 + 8.1331633999999964e-01 * logT + T * (8.5664779295785138e-04 + T * (-2.1731609697396752e-07 + T * (2.5374078072070635e-11 + -1.2626227000901320e-15 * T))) - -1.5917062100000003e+04 / T);
+  }
+
+  k[342] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.2416207799999999e+00 + -1.5605716300000005e+00 * logT + T * (5.3208999249999998e-03 + T * (-2.8997540666666668e-06 + T * (1.0011957933333334e-09 + -1.4762313550000001e-13 * T))) - -3.0868997399999935e+03 / T);
+  } else {
+    Kc = (-1.8165278799999998e+00 + 1.1515388000000026e-01 * logT + T * (7.3724185049999988e-04 + T * (-1.7828343233333334e-07 + T * (2.0328767283333333e-11 + -9.6460179500000001e-16 * T))) - -3.2659418999999980e+03 / T);
+  }
+
+  k[343] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.3644163899999997e+00 + -1.4001935599999999e+00 * logT + T * (4.7390486950000003e-03 + T * (-2.2891915250000001e-06 + T * (7.2250737333333334e-10 + -9.9906230000000010e-14 * T))) - -6.8396602399999974e+03 / T);
+  } else {
+    Kc = (-6.6930056899999997e+00 + 6.9308694000000015e-01 * logT + T * (3.4633183564999995e-04 + T * (-6.2912707016666668e-08 + T * (-2.4546240833333114e-13 + 4.6944497049999995e-16 * T))) - -7.2260281800000012e+03 / T);
+  }
+
+  k[344] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.0045269289999998e+00 + -1.1982776200000003e+00 * logT + T * (1.5130812603526670e-03 + T * (6.6368171633401331e-07 + T * (-8.1247476397493195e-10 + 2.4157591845361340e-13 * T))) - -1.0604111926999998e+04 / T);
+  } else {
+    Kc = (2.3280608859999998e+00 + -7.8102048999999996e-01 * logT + T * (1.5761872375078514e-03 + T * (-3.0995585030730089e-07 + T * (3.4534647105403977e-11 + -1.7119355700901321e-15 * T))) - -1.0705077178000007e+04 / T);
+  }
+
+  k[345] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.6159542499999997e+00 + 1.8028118699999998e+00 * logT + T * (-5.3875898200000010e-03 + T * (2.3002309616666666e-06 + T * (-5.9189663966666670e-10 + 5.5892614550000019e-14 * T))) - -4.8304199200000003e+04 / T);
+  } else {
+    Kc = (1.3693731849999999e+01 + -1.7458140700000002e+00 * logT + T * (5.1721487185000018e-04 + T * (-9.8268863316666693e-08 + T * (1.3469789741666667e-11 + -8.2644594049999995e-16 * T))) - -4.7452599900000001e+04 / T);
+  }
+
+  k[346] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.4925558370000003e+00 + 1.7455111699999999e+00 * logT + T * (-4.5518652503526670e-03 + T * (1.3190632219993198e-06 + T * (-1.1775385985840135e-10 + -3.0438084903613376e-14 * T))) - -1.2619593899999993e+04 / T);
+  } else {
+    Kc = (1.8703722633999998e+01 + -2.1533061000000000e+00 * logT + T * (5.4359717654214889e-04 + T * (-9.0545787859365817e-08 + T * (1.3375877811262696e-11 + -8.3857097490986797e-16 * T))) - -1.1508807300000000e+04 / T);
+  }
+
+  k[347] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.5830298549999995e+00 + 2.4790635399999998e+00 * logT + T * (-5.8265904796473344e-03 + T * (2.6377518863340136e-06 + T * (-7.7914104864159860e-10 + 9.3319865003613392e-14 * T))) - 2.6766393399999979e+03 / T);
+  } else {
+    Kc = (1.1578158355999999e+01 + -7.6928095000000019e-01 * logT + T * (2.0001294545785150e-04 + T * (-1.1236165547396756e-07 + T * (1.9963820655403973e-11 + -1.3520909500901322e-15 * T))) - 3.3799821000000011e+03 / T);
+  }
+
+  k[348] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.8368716899999997e+00 + 1.5512796700000000e+00 * logT + T * (-4.0036410400000003e-03 + T * (9.0670095500000012e-07 + T * (1.4556870700000011e-10 + -1.0089594994999997e-13 * T))) - -8.6152099900000001e+04 / T);
+  } else {
+    Kc = (1.3620173909999998e+01 + -1.9263017900000001e+00 * logT + T * (5.3521874000000014e-04 + T * (-9.4657758500000024e-08 + T * (1.2742180249999999e-11 + -7.9921123999999990e-16 * T))) - -8.5212566099999996e+04 / T);
+  }
+
+  k[349] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.9210436999999896e-01 + -3.4137340000000016e-02 * logT + T * (-7.3140693500000058e-04 + T * (4.0946178333333354e-07 + T * (-1.6644554083333330e-10 + 3.7375429100000013e-14 * T))) - -5.2145880140000001e+04 / T);
+  } else {
+    Kc = (7.0486319200000001e+00 + -1.3166564499999995e+00 * logT + T * (9.0860545999999994e-04 + T * (-1.6761438683333339e-07 + T * (1.9632193500000007e-11 + -1.0236223650000002e-15 * T))) - -5.1753856679999997e+04 / T);
+  }
+
+  k[350] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.1007492900000004e+00 + 2.2526026699999999e+00 * logT + T * (-4.7077612400000003e-03 + T * (1.5672379550000001e-06 + T * (-3.2455754299999995e-10 + 2.1346750050000008e-14 * T))) - 2.7078074000000001e+04 / T);
+  } else {
+    Kc = (1.5033619309999999e+01 + -1.0210559899999998e+00 * logT + T * (-3.3879009999999871e-05 + T * (-3.9586321833333355e-08 + T * (9.3656894166666670e-12 + -6.6515351000000003e-16 * T))) - 2.7977777600000001e+04 / T);
+  }
+
+  k[351] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.6438137099999990e+00 + -1.2087234300000000e+00 * logT + T * (3.2640907599999994e-03 + T * (-2.5514855449999996e-06 + T * (1.2602854570000002e-09 + -2.6536800995000000e-13 * T))) - -3.0129411599999999e+04 / T);
+  } else {
+    Kc = (2.6664619099999998e+00 + -8.7453159000000014e-01 * logT + T * (5.9663606500000006e-04 + T * (-1.0797208350000001e-07 + T * (1.4392623249999999e-11 + -8.5042962000000006e-16 * T))) - -3.0003565199999997e+04 / T);
+  }
+
+  k[352] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.4100697999999996e+00 + -1.3899565799999998e+00 * logT + T * (3.1133221850000001e-03 + T * (-2.2901988816666664e-06 + T * (1.0529286850000000e-09 + -2.0303855239999998e-13 * T))) - -7.3919969600000011e+04 / T);
+  } else {
+    Kc = (6.0558191699999977e+00 + -1.6286898099999996e+00 * logT + T * (1.2030333300000000e-03 + T * (-2.4563133833333340e-07 + T * (3.3925993250000005e-11 + -2.0415178950000001e-15 * T))) - -7.3607061300000001e+04 / T);
+  }
+
+  k[353] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.2365717529999998e+00 + 2.8539465000000002e+00 * logT + T * (-5.5033416346473331e-03 + T * (2.5826767830006802e-06 + T * (-8.6729268564159879e-10 + 1.2722996195361339e-13 * T))) - 6.2469366899999994e+04 / T);
+  } else {
+    Kc = (-1.6791242240000002e+00 + 1.4437413100000001e+00 * logT + T * (-1.5514860240421488e-03 + T * (2.2671305935936580e-07 + T * (-1.9570781727929365e-11 + 7.1065873990986783e-16 * T))) - 6.2602555899999999e+04 / T);
+  }
+
+  k[354] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.7642687129999999e+00 + -1.0032489999999994e-01 * logT + T * (1.0166588203526670e-03 + T * (-2.7965239366598648e-07 + T * (6.9784470191734520e-11 + -2.1755820546386616e-14 * T))) - -3.6787553000000025e+03 / T);
+  } else {
+    Kc = (-1.0631272183999998e+01 + 1.2805245299999997e+00 * logT + T * (-3.7763630469214889e-04 + T * (2.3489754542699133e-08 + T * (-6.9073456959603031e-13 + -2.6318950590132193e-17 * T))) - -4.1470881999999983e+03 / T);
+  }
+
+  k[355] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.2568245499999993e+00 + 1.6451862700000000e+00 * logT + T * (-3.5352064300000000e-03 + T * (1.0394108283333334e-06 + T * (-4.7969389666666777e-11 + -5.2193905449999999e-14 * T))) - -1.6298349199999997e+04 / T);
+  } else {
+    Kc = (8.0724504500000016e+00 + -8.7278157000000078e-01 * logT + T * (1.6596087185000001e-04 + T * (-6.7056033316666684e-08 + T * (1.2685143241666666e-11 + -8.6488992550000001e-16 * T))) - -1.5655895499999999e+04 / T);
+  }
+
+  k[356] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.2694961480000018e+00 + 2.1776948300000001e+00 * logT + T * (-5.0643409749999996e-03 + T * (2.2451558583333332e-06 + T * (-6.8004827666666689e-10 + 8.9802711500000001e-14 * T))) - 1.1488528359999997e+04 / T);
+  } else {
+    Kc = (4.3644927000000022e-01 + 4.6720818999999958e-01 * logT + T * (-1.2342840976500003e-03 + T * (2.4080585151666663e-07 + T * (-2.6064812641666665e-11 + 1.2363037494999999e-15 * T))) - 1.1769973900000005e+04 / T);
+  }
+
+  k[357] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.5081952650000003e+00 + -2.7510040299999998e+00 * logT + T * (-3.8249262396473334e-03 + T * (1.4556374313340135e-06 + T * (-5.1760130564159879e-10 + 8.2239404953613387e-14 * T))) - 7.1459463399999986e+03 / T);
+  } else {
+    Kc = (-2.1037122539999999e+00 + -3.3951268600000000e+00 * logT + T * (-1.8474262695421487e-03 + T * (1.5611888135936581e-07 + T * (-6.5209515945960296e-12 + -9.7074005090132177e-17 * T))) - 7.2077108999999991e+03 / T);
+  }
+
+  if (T <= 1368.0) {
+    Kc += (1.8468721000000001e+00 + 2.7860495200000002e+00 * logT + T * (3.4433396099999999e-03 + T * (-5.3581310666666662e-07 + T * (4.3099647250000000e-11 + 5.9680394000000003e-16 * T))) - -2.8269839999999999e+03 / T);
+  } else {
+    Kc += (-1.2079527100000000e+01 + 4.8978488499999999e+00 * logT + T * (1.5839469650000000e-03 + T * (-1.8633510666666667e-07 + T * (1.4770262000000000e-11 + -5.2169588499999993e-16 * T))) - -3.7065333099999998e+03 / T);
+  }
+
+  k[358] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.5081952650000003e+00 + -2.7510040299999998e+00 * logT + T * (-3.8249262396473334e-03 + T * (1.4556374313340135e-06 + T * (-5.1760130564159879e-10 + 8.2239404953613387e-14 * T))) - 7.1459463399999986e+03 / T);
+  } else {
+    Kc = (-2.1037122539999999e+00 + -3.3951268600000000e+00 * logT + T * (-1.8474262695421487e-03 + T * (1.5611888135936581e-07 + T * (-6.5209515945960296e-12 + -9.7074005090132177e-17 * T))) - 7.2077108999999991e+03 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (2.5636141000000001e+00 + 2.6309631699999998e+00 * logT + T * (3.6514117850000001e-03 + T * (-3.8008333833333334e-07 + T * (-5.5105941500000004e-11 + 1.8111787599999998e-14 * T))) - -1.5587363600000001e+04 / T);
+  } else {
+    Kc += (-1.4606198750000001e+01 + 5.2239513400000002e+00 * logT + T * (1.5893200200000001e-03 + T * (-1.8229792500000000e-07 + T * (1.4227930250000000e-11 + -4.9751097749999999e-16 * T))) - -1.6659934399999998e+04 / T);
+  }
+
+  k[359] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.9784819819999999e+00 + 1.5325323399999999e+00 * logT + T * (-5.1831723300000002e-03 + T * (2.8095789533333332e-06 + T * (-9.0964412383333345e-10 + 1.1922176505000000e-13 * T))) - -1.0785889560000000e+04 / T);
+  } else {
+    Kc = (9.6321469799999981e+00 + -1.3451991599999999e+00 * logT + T * (7.8749155700000002e-04 + T * (-1.6600342316666668e-07 + T * (2.4069260299999997e-11 + -1.5113433300000000e-15 * T))) - -1.0245864400000002e+04 / T);
+  }
+
+  k[360] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.4303196529999993e+00 + -9.0732759999999990e-01 * logT + T * (-2.1779684503526668e-03 + T * (2.4038171669993197e-06 + T * (-9.7624675019173469e-10 + 1.3868959954638661e-13 * T))) - -1.1548472900000001e+04 / T);
+  } else {
+    Kc = (-4.4807189760000012e+00 + -9.2536209999999564e-02 * logT + T * (-8.8565838457851410e-05 + T * (1.2960992897396754e-07 + T * (-2.7479380438737304e-11 + 2.0116172750901319e-15 * T))) - -1.2203842900000000e+04 / T);
+  }
+
+  k[361] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.3834506199999996e+00 + 1.7096946700000002e+00 * logT + T * (-1.6590602784999999e-03 + T * (-3.7324393166666659e-07 + T * (2.8443462249999998e-10 + -2.6116299999999991e-14 * T))) - -3.9759316800000001e+04 / T);
+  } else {
+    Kc = (1.3771494409999999e+01 + -1.8249047700000003e+00 * logT + T * (1.0000939850000000e-03 + T * (-2.6213989499999998e-07 + T * (4.1206556999999996e-11 + -2.6961299249999995e-15 * T))) - -3.8470075700000001e+04 / T);
+  }
+
+  k[362] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.6729083000000013e-01 + 2.6001854999999985e-01 * logT + T * (-1.0211079730000001e-03 + T * (8.9562124249999987e-07 + T * (-4.3537027841666673e-10 + 8.5701449699999992e-14 * T))) - 2.3389993700000006e+04 / T);
+  } else {
+    Kc = (-4.0882765499999998e+00 + 7.4261452000000006e-01 * logT + T * (-6.5881215170000005e-04 + T * (1.3649094200000000e-07 + T * (-1.4735420324999998e-11 + 7.0017245149999993e-16 * T))) - 2.3141463400000001e+04 / T);
+  }
+
+  k[363] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.1054725699999999e+00 + -2.0295050500000000e+00 * logT + T * (4.1595470295000001e-03 + T * (-1.2832583916666670e-06 + T * (1.0738839416666668e-10 + 4.2102093499999997e-14 * T))) - 1.0408765000000058e+03 / T);
+  } else {
+    Kc = (-5.6535156600000001e+00 + 4.1307736999999989e-01 * logT + T * (4.3121148449999994e-04 + T * (-1.2636864083333333e-07 + T * (1.8845107000000001e-11 + -1.1345221250000002e-15 * T))) - 4.5142629999999917e+02 / T);
+  }
+
+  k[364] = exp(Kc);
+
+  k[365] = exp(2.4412145291060348e+01 - (1.8367514117359440e+03 / T));
+  k[366] = exp(1.1407564949312402e+01 + 1.5 * logT - (-2.3148099983521487e+02 / T));
+  k[367] = exp(2.5590800287401994e+01 - 0.11 * logT - (2.5060334329986304e+03 / T));
+  k[368] = exp(3.1433229255349488e+01 - 1.32 * logT - (3.7238247799578045e+02 / T));
+  k[369] = exp(2.0617905321288585e+01 + 0.72 * logT - (3.3212491280704739e+02 / T));
+  k[370] = exp(9.4727046364436731e+00 + 1.9 * logT - (-4.7805858661620459e+02 / T));
+  k[371] = exp(2.3025850929940457e+01 - (6.5418543431691160e+03 / T));
+  k[372] = exp(2.2802707378626248e+01 - (3.7540179538493539e+03 / T));
+  k[373] = exp(2.2538090579105461e+01 - (-2.2141660853803160e+02 / T));
+  k[374] = exp(5.6869753563398202e+00 + 2.45 * logT - (1.1272118252845246e+03 / T));
+  k[375] = exp(2.1416413017506358e+01 - (1.0064391297183254e+04 / T));
+  k[376] = exp(2.6459838134425603e+01 - (2.7199017480637747e+04 / T));
+  k[377] = exp(3.2878045188089033e+01 - 1.52 * logT - (3.7238247799578045e+02 / T));
+  k[378] = exp(3.5873777461643023e+01 - 2.0 * logT - (4.0257565188733020e+02 / T));
+  k[379] = exp(5.9906433130998472e+01 - 3.3 * logT - (6.3707596911170003e+04 / T));
+  k[380] = exp(3.0106208860477417e+00 + 2.64 * logT - (2.5060334329986304e+03 / T));
+  k[381] = exp(1.6233408176030919e+00 + 2.64 * logT - (2.5060334329986304e+03 / T));
+  k[382] = exp(1.5179047931961549e+01 + 1.58 * logT - (1.3385640425253729e+04 / T));
+  k[383] = exp(7.0030654587864616e+00 + 2.03 * logT - (6.7280455821670057e+03 / T));
+  k[384] = exp(1.4816045409242156e+00 + 2.26 * logT - (3.2206052150986416e+03 / T));
+  k[385] = exp(-1.8325814637483102e+00 + 2.56 * logT - (4.5289760837324648e+03 / T));
+  k[386] = exp(2.4817610399168512e+01 - (2.0128782594366510e+02 / T));
+  k[387] = exp(2.4866400563337944e+01 - (2.3158164374818669e+04 / T));
+  k[388] = exp(1.4953343559785665e+01 + 0.88 * logT - (1.0129809840614946e+04 / T));
+  if (T <= 1000.0) {
+    Kc = (9.9056611700000001e+00 + -3.2641742499999999e+00 * logT + T * (7.1142715294999995e-03 + T * (-2.1940235583333335e-06 + T * (2.7682097750000004e-10 + 3.0760343499999991e-14 * T))) - -1.5514409499999998e+04 / T);
+  } else {
+    Kc = (-1.6658089659999998e+01 + 1.0895314699999998e+00 * logT + T * (7.6535270950000016e-04 + T * (-1.9570127583333331e-07 + T * (2.6850951583333335e-11 + -1.5474636650000002e-15 * T))) - -1.6636697700000008e+04 / T);
+  }
+
+  k[389] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.5613244200000009e+00 + -1.3094585700000003e+00 * logT + T * (3.9929247185000001e-03 + T * (-2.2787479683333335e-06 + T * (8.9861581083333338e-10 + -1.6435813450000000e-13 * T))) - 1.1610121800000004e+04 / T);
+  } else {
+    Kc = (-5.6206721100000001e+00 + 7.8519086999999965e-01 * logT + T * (-3.3405195999999988e-04 + T * (8.1570499999999996e-08 + T * (-9.7169881666666630e-12 + 5.1109518499999994e-16 * T))) - 1.1187333699999999e+04 / T);
+  }
+
+  k[390] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.3289006769999983e+00 + -1.7453840100000000e+00 * logT + T * (5.6606678849999998e-03 + T * (-3.1850919333333334e-06 + T * (1.1350531675000000e-09 + -1.7714464350000000e-13 * T))) - 7.1173456000000006e+03 / T);
+  } else {
+    Kc = (-8.6580432700000003e+00 + 1.3672535799999999e+00 * logT + T * (-8.3379868499999993e-04 + T * (1.8206608333333335e-07 + T * (-2.2860859083333339e-11 + 1.2710391749999996e-15 * T))) - 6.5249380000000019e+03 / T);
+  }
+
+  k[391] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.8820827000000016e-01 + 8.4863500000000869e-03 * logT + T * (3.6284080700000021e-04 + T * (-4.9790876416666681e-07 + T * (3.0209506825000003e-10 + -7.1087114800000005e-14 * T))) - -1.4457907000000007e+04 / T);
+  } else {
+    Kc = (-4.1618344900000013e+00 + 5.6212680000000015e-01 * logT + T * (-6.4080828354999998e-04 + T * (1.4010204681666666e-07 + T * (-1.5463029816666667e-11 + 7.2740715199999998e-16 * T))) - -1.4618502799999995e+04 / T);
+  }
+
+  k[392] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.5833454799999997e+00 + -6.9318238000000010e-01 * logT + T * (2.1750800220000002e-03 + T * (-1.7929999858333333e-06 + T * (9.1461468108333340e-10 + -1.9872614724999999e-13 * T))) - -5.3527955199999997e+04 / T);
+  } else {
+    Kc = (1.9196368599999989e+00 + -6.2214597000000005e-01 * logT + T * (4.9916242580000012e-04 + T * (-1.0270757983333336e-07 + T * (1.2782706758333333e-11 + -6.7472404850000003e-16 * T))) - -5.3390369300000006e+04 / T);
+  }
+
+  k[393] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.8845551299999990e+00 + -2.2810372499999998e+00 * logT + T * (5.5434958095000007e-03 + T * (-2.6767883983333337e-06 + T * (8.4485374083333344e-10 + -1.1468647100000000e-13 * T))) - -3.6807024199999993e+04 / T);
+  } else {
+    Kc = (-5.7270736000000007e+00 + 2.3258964999999998e-01 * logT + T * (4.4921535265000001e-04 + T * (-1.2275753601666667e-07 + T * (1.8117497508333335e-11 + -1.1072874244999998e-15 * T))) - -3.7308539900000003e+04 / T);
+  }
+
+  k[394] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.1202864169999991e+00 + -2.3813621499999997e+00 * logT + T * (6.5601546298526678e-03 + T * (-2.9564407919993198e-06 + T * (9.1463821102506801e-10 + -1.3644229154638662e-13 * T))) - -4.0485779500000004e+04 / T);
+  } else {
+    Kc = (-1.6358345784000001e+01 + 1.5131141799999996e+00 * logT + T * (7.1579047957851327e-05 + T * (-9.9267781473967528e-08 + T * (1.7426762938737301e-11 + -1.1336063750901319e-15 * T))) - -4.1455628100000002e+04 / T);
+  }
+
+  k[395] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.2105307599999993e+00 + -9.8710710999999929e-01 * logT + T * (5.3560756950000012e-04 + T * (7.3798554166666652e-07 + T * (-5.9503726416666657e-10 + 1.4701011600000000e-13 * T))) - -2.0697714439999996e+04 / T);
+  } else {
+    Kc = (3.5446248799999989e+00 + -9.5095304999999986e-01 * logT + T * (1.4849139645000001e-03 + T * (-3.8645916583333338e-07 + T * (5.6718183583333336e-11 + -3.4480648850000002e-15 * T))) - -2.0787719850000009e+04 / T);
+  }
+
+  k[396] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1910938669999998e+00 + -4.4811549700000004e+00 * logT + T * (1.8350519288526665e-03 + T * (-2.3059867353326534e-06 + T * (1.0989205776917348e-09 + -2.2454970954638660e-13 * T))) - -3.0375003199999999e+04 / T);
+  } else {
+    Kc = (-9.3524721340000010e+00 + -2.6347067200000001e+00 * logT + T * (-2.4237486215421488e-03 + T * (3.0635274435936579e-07 + T * (-2.7469768561262694e-11 + 1.1403183549098680e-15 * T))) - -3.0710918700000002e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (2.5636141000000001e+00 + 2.6309631699999998e+00 * logT + T * (3.6514117850000001e-03 + T * (-3.8008333833333334e-07 + T * (-5.5105941500000004e-11 + 1.8111787599999998e-14 * T))) - -1.5587363600000001e+04 / T);
+  } else {
+    Kc += (-1.4606198750000001e+01 + 5.2239513400000002e+00 * logT + T * (1.5893200200000001e-03 + T * (-1.8229792500000000e-07 + T * (1.4227930250000000e-11 + -4.9751097749999999e-16 * T))) - -1.6659934399999998e+04 / T);
+  }
+
+  k[397] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.6992891319999996e+00 + -1.7301509400000001e+00 * logT + T * (5.6599781685000008e-03 + T * (-3.7616241666666661e-06 + T * (1.6165218833333334e-09 + -3.0678911449999998e-13 * T))) - -3.7520949539999994e+04 / T);
+  } else {
+    Kc = (-7.2487598799999997e+00 + 7.6042013999999991e-01 * logT + T * (-5.7632235199999988e-04 + T * (1.5023386300000000e-07 + T * (-2.0948816966666665e-11 + 1.2373923599999999e-15 * T))) - -3.7918629600000000e+04 / T);
+  }
+
+  k[398] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1910938669999998e+00 + -4.4811549700000004e+00 * logT + T * (1.8350519288526665e-03 + T * (-2.3059867353326534e-06 + T * (1.0989205776917348e-09 + -2.2454970954638660e-13 * T))) - -3.0375003199999999e+04 / T);
+  } else {
+    Kc = (-9.3524721340000010e+00 + -2.6347067200000001e+00 * logT + T * (-2.4237486215421488e-03 + T * (3.0635274435936579e-07 + T * (-2.7469768561262694e-11 + 1.1403183549098680e-15 * T))) - -3.0710918700000002e+04 / T);
+  }
+
+  if (T <= 1382.0) {
+    Kc += (8.0860173100000008e+00 + 1.6472798900000001e+00 * logT + T * (6.3752671000000000e-03 + T * (-1.7465705999999998e-06 + T * (3.6786069666666668e-10 + -3.7876073300000002e-14 * T))) - 1.9299025200000000e+04 / T);
+  } else {
+    Kc += (-1.6929264459999999e+01 + 5.5986045600000001e+00 * logT + T * (1.5138931300000000e-03 + T * (-1.7950724333333333e-07 + T * (1.4305544000000000e-11 + -5.0719695499999999e-16 * T))) - 1.7966133900000001e+04 / T);
+  }
+
+  k[399] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.9586701239999997e+00 + -4.9170804099999996e+00 * logT + T * (3.5027950953526667e-03 + T * (-3.2123307003326528e-06 + T * (1.3353579343584013e-09 + -2.3733621854638666e-13 * T))) - -3.4867779399999999e+04 / T);
+  } else {
+    Kc = (-1.2389843294000002e+01 + -2.0526440099999999e+00 * logT + T * (-2.9234953465421486e-03 + T * (4.0684832769269914e-07 + T * (-4.0613639477929367e-11 + 1.9002623449098677e-15 * T))) - -3.5373314400000003e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (2.5636141000000001e+00 + 2.6309631699999998e+00 * logT + T * (3.6514117850000001e-03 + T * (-3.8008333833333334e-07 + T * (-5.5105941500000004e-11 + 1.8111787599999998e-14 * T))) - -1.5587363600000001e+04 / T);
+  } else {
+    Kc += (-1.4606198750000001e+01 + 5.2239513400000002e+00 * logT + T * (1.5893200200000001e-03 + T * (-1.8229792500000000e-07 + T * (1.4227930250000000e-11 + -4.9751097749999999e-16 * T))) - -1.6659934399999998e+04 / T);
+  }
+
+  k[400] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.4668653889999987e+00 + -2.1660763800000002e+00 * logT + T * (7.3277213350000014e-03 + T * (-4.6679681316666663e-06 + T * (1.8529592400000001e-09 + -3.1957562350000003e-13 * T))) - -4.2013725739999994e+04 / T);
+  } else {
+    Kc = (-1.0286131039999999e+01 + 1.3424828500000001e+00 * logT + T * (-1.0760690769999999e-03 + T * (2.5072944633333332e-07 + T * (-3.4092687883333338e-11 + 1.9973363500000001e-15 * T))) - -4.2581025300000001e+04 / T);
+  }
+
+  k[401] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.9586701239999997e+00 + -4.9170804099999996e+00 * logT + T * (3.5027950953526667e-03 + T * (-3.2123307003326528e-06 + T * (1.3353579343584013e-09 + -2.3733621854638666e-13 * T))) - -3.4867779399999999e+04 / T);
+  } else {
+    Kc = (-1.2389843294000002e+01 + -2.0526440099999999e+00 * logT + T * (-2.9234953465421486e-03 + T * (4.0684832769269914e-07 + T * (-4.0613639477929367e-11 + 1.9002623449098677e-15 * T))) - -3.5373314400000003e+04 / T);
+  }
+
+  if (T <= 1382.0) {
+    Kc += (8.0860173100000008e+00 + 1.6472798900000001e+00 * logT + T * (6.3752671000000000e-03 + T * (-1.7465705999999998e-06 + T * (3.6786069666666668e-10 + -3.7876073300000002e-14 * T))) - 1.9299025200000000e+04 / T);
+  } else {
+    Kc += (-1.6929264459999999e+01 + 5.5986045600000001e+00 * logT + T * (1.5138931300000000e-03 + T * (-1.7950724333333333e-07 + T * (1.4305544000000000e-11 + -5.0719695499999999e-16 * T))) - 1.7966133900000001e+04 / T);
+  }
+
+  k[402] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.6164365019999991e+00 + -1.4344375400000002e+00 * logT + T * (5.3213800750000007e-03 + T * (-3.9337669083333330e-06 + T * (1.7343073358333336e-09 + -3.2921794850000001e-13 * T))) - -4.1870715499999998e+04 / T);
+  } else {
+    Kc = (-9.5970526600000028e+00 + 1.2899083700000000e+00 * logT + T * (-1.5538319149999999e-03 + T * (3.6483715699999999e-07 + T * (-4.9665560833333334e-11 + 2.8884695750000003e-15 * T))) - -4.2293563999999998e+04 / T);
+  }
+
+  k[403] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.0518051819999981e+00 + -1.0483902700000001e+00 * logT + T * (2.9609699150000002e-03 + T * (-1.8470270249999999e-06 + T * (8.9196369333333313e-10 + -2.1092152250000002e-13 * T))) - 5.9632787599999992e+03 / T);
+  } else {
+    Kc = (-1.7573423740000003e+01 + 2.7562673500000003e+00 * logT + T * (-2.4566419270000001e-03 + T * (5.4287671300000004e-07 + T * (-7.6386955716666673e-11 + 4.6461437950000003e-15 * T))) - 4.8392071000000042e+03 / T);
+  }
+
+  k[404] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0401329003000001e+01 + 2.6856239700000000e+00 * logT + T * (-5.9417067196473328e-03 + T * (1.5378137280006799e-06 + T * (4.5920593858401363e-11 + -1.1131002049638659e-13 * T))) - -7.3275569199999998e+04 / T);
+  } else {
+    Kc = (1.3993475726000000e+01 + -1.3222313600000000e+00 * logT + T * (-1.7655878969214853e-04 + T * (-1.8353689573008753e-09 + T * (4.0456010970706355e-12 + -4.1258865059013206e-16 * T))) - -7.2271530299999984e+04 / T);
+  }
+
+  k[405] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.3153935599999991e+00 + 7.8487839999999931e-01 * logT + T * (-3.6345530800000001e-03 + T * (1.6437581733333331e-06 + T * (-4.3677168000000007e-10 + 4.5887614500000017e-14 * T))) - -5.8826987199999996e+04 / T);
+  } else {
+    Kc = (9.6646865399999999e+00 + -1.4012121800000004e+00 * logT + T * (2.1695265685000008e-04 + T * (1.0650093516666675e-08 + T * (-3.9017442583333337e-12 + 2.5164910950000011e-16 * T))) - -5.8342253499999999e+04 / T);
+  }
+
+  k[406] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.0318222020000000e+01 + 3.3813541800000007e+00 * logT + T * (-9.0394442999999994e-03 + T * (4.2381397583333326e-06 + T * (-1.3537671208333331e-09 + 1.9987518949999999e-13 * T))) - -2.1257116179999997e+04 / T);
+  } else {
+    Kc = (2.1121969350000001e+01 + -1.9089388799999991e+00 * logT + T * (4.4313725314999958e-04 + T * (-1.0912983368333334e-07 + T * (1.4845822758333340e-11 + -8.5547098950000023e-16 * T))) - -2.0057783729999999e+04 / T);
+  }
+
+  k[407] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.1774109749999990e+00 + 2.5035280100000006e+00 * logT + T * (-7.6974931996473331e-03 + T * (4.0025230313340135e-06 + T * (-1.3264417473082653e-09 + 1.8822288745361339e-13 * T))) - -2.9584739599999997e+04 / T);
+  } else {
+    Kc = (1.6747253585999999e+01 + -1.7887094799999996e+00 * logT + T * (9.5345321045785139e-04 + T * (-2.6353322364063423e-07 + T * (4.0465363238737310e-11 + -2.5875386600901322e-15 * T))) - -2.8748817649999997e+04 / T);
+  }
+
+  k[408] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-7.7533195670000001e+00 + 2.0370362700000002e+00 * logT + T * (-6.7917532288526653e-03 + T * (2.9413384019993197e-06 + T * (-8.6124471102506807e-10 + 1.2391504954638661e-13 * T))) - -3.4752503699999994e+04 / T);
+  } else {
+    Kc = (2.0295349434000002e+01 + -2.5938950800000002e+00 * logT + T * (5.7738692154214863e-04 + T * (-6.3197331026032502e-08 + T * (5.7213319779293613e-12 + -2.7157110990986780e-16 * T))) - -3.3585794599999994e+04 / T);
+  }
+
+  k[409] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.0160316400000005e+00 + 1.6814149199999999e+00 * logT + T * (6.2878537950000002e-03 + T * (-2.5426125083333334e-06 + T * (9.2240838833333331e-10 + -1.6460279789999999e-13 * T))) - -3.5613599900000001e+04 / T);
+  } else {
+    Kc = (-8.4365298999999982e-01 + 3.0717323099999998e+00 * logT + T * (2.9150936868499997e-03 + T * (-4.4692382815000006e-07 + T * (5.0988039075000003e-11 + -2.6970600155000002e-15 * T))) - -3.5855897100000002e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[410] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.7384404499999992e+00 + 3.9447579699999995e+00 * logT + T * (-1.5003259699999999e-03 + T * (2.1411595616666667e-06 + T * (-8.4183515633333335e-10 + 1.2641865455000002e-13 * T))) - -3.1918048200000001e+04 / T);
+  } else {
+    Kc = (8.5157061500000015e+00 + 2.1250157299999994e+00 * logT + T * (2.8214537218500002e-03 + T * (-3.0437866831666667e-07 + T * (2.4795865158333334e-11 + -1.0893233835000000e-15 * T))) - -3.1618869500000001e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[411] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.7439265520000000e+00 + 2.6506791299999999e+00 * logT + T * (4.8415850600000004e-03 + T * (-1.7352898250000000e-06 + T * (5.8738577583333326e-10 + -1.0399522550000000e-13 * T))) - -1.0824701640000001e+04 / T);
+  } else {
+    Kc = (-8.5275599299999989e+00 + 4.6756513899999996e+00 * logT + T * (1.4697899648500000e-03 + T * (-1.3262912681666665e-07 + T * (5.8302170249999993e-12 + 7.0755054500000033e-17 * T))) - -1.1354799100000000e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[412] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4702867170000000e+00 + 4.2835363700000002e+00 * logT + T * (-1.3582460903526666e-03 + T * (1.3539415219993202e-06 + T * (-3.9204281819173466e-10 + 3.6982360096386612e-14 * T))) - -1.7931835899999998e+04 / T);
+  } else {
+    Kc = (1.1735859233999999e+01 + 2.0499277000000000e+00 * logT + T * (2.6349178265421486e-03 + T * (-3.2212230452603252e-07 + T * (3.0590211894596026e-11 + -1.4142693249098678e-15 * T))) - -1.7453575300000000e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[413] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.0088957710000006e+00 + 1.6712619200000001e+00 * logT + T * (8.3928447746473324e-03 + T * (-4.6441273996673469e-06 + T * (2.0799088164749320e-09 + -4.3537385545361338e-13 * T))) - -1.1709118073000000e+04 / T);
+  } else {
+    Kc = (-1.1292070085999999e+01 + 4.9894636899999991e+00 * logT + T * (1.1278868249921486e-03 + T * (-6.3479128026032469e-08 + T * (-2.6396174387373064e-12 + 5.4638687509013205e-16 * T))) - -1.2419695821999998e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[414] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.7718019200000006e+00 + 2.0335559300000003e+00 * logT + T * (4.5850261100000003e-03 + T * (-1.0806916166666668e-06 + T * (2.6623825916666662e-10 + -4.6174801500000004e-14 * T))) - -1.9226330260000002e+04 / T);
+  } else {
+    Kc = (-7.1474813199999989e+00 + 4.0932893200000002e+00 * logT + T * (1.9668322120000000e-03 + T * (-1.9515154599999999e-07 + T * (1.1566262383333333e-11 + -2.0094690000000001e-16 * T))) - -1.9858831100000003e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[415] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.2943742080000007e+00 + 1.5687609899999999e+00 * logT + T * (4.6398878950000000e-03 + T * (-7.7244438333333316e-07 + T * (6.0733654166666666e-11 + 6.8128726000000001e-15 * T))) - -3.0101140260000000e+04 / T);
+  } else {
+    Kc = (7.1604353999999981e-01 + 2.5993147200000002e+00 * logT + T * (3.5366243719999997e-03 + T * (-5.4587121800000003e-07 + T * (6.2372156133333337e-11 + -3.3435134199999999e-15 * T))) - -3.0445865999999998e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc += (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  k[416] = exp(Kc);
+
+  if (T <= 1478.0) {
+    Kc = (-2.5636141000000001e+00 + -2.6309631699999998e+00 * logT + T * (-3.6514117850000001e-03 + T * (3.8008333833333334e-07 + T * (5.5105941500000004e-11 + -1.8111787599999998e-14 * T))) - 1.5587363600000001e+04 / T);
+  } else {
+    Kc = (1.4606198750000001e+01 + -5.2239513400000002e+00 * logT + T * (-1.5893200200000001e-03 + T * (1.8229792500000000e-07 + T * (-1.4227930250000000e-11 + 4.9751097749999999e-16 * T))) - 1.6659934399999998e+04 / T);
+  }
+
+  if (T <= 1000.0) {
+    Kc += (-1.7157048899999998e+00 + 5.0724419699999999e+00 * logT + T * (-1.4928085000000000e-04 + T * (-7.8705678333333339e-08 + T * (2.8238750699999998e-10 + -9.7006059949999999e-14 * T))) - 2.7536543000000001e+04 / T);
+  } else {
+    Kc += (8.0605892099999998e+00 + 3.4988784099999997e+00 * logT + T * (1.6961852150000002e-03 + T * (-2.3726770683333335e-07 + T * (2.5700125749999999e-11 + -1.2934609300000001e-15 * T))) - 2.7968975599999998e+04 / T);
+  }
+
+  k[417] = 1.2186597134166982e+01 * exp(Kc);
+
+  if (T <= 1382.0) {
+    Kc = (-8.0860173100000008e+00 + -1.6472798900000001e+00 * logT + T * (-6.3752671000000000e-03 + T * (1.7465705999999998e-06 + T * (-3.6786069666666668e-10 + 3.7876073300000002e-14 * T))) - -1.9299025200000000e+04 / T);
+  } else {
+    Kc = (1.6929264459999999e+01 + -5.5986045600000001e+00 * logT + T * (-1.5138931300000000e-03 + T * (1.7950724333333333e-07 + T * (-1.4305544000000000e-11 + 5.0719695499999999e-16 * T))) - -1.7966133900000001e+04 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (2.5636141000000001e+00 + 2.6309631699999998e+00 * logT + T * (3.6514117850000001e-03 + T * (-3.8008333833333334e-07 + T * (-5.5105941500000004e-11 + 1.8111787599999998e-14 * T))) - -1.5587363600000001e+04 / T);
+  } else {
+    Kc += (-1.4606198750000001e+01 + 5.2239513400000002e+00 * logT + T * (1.5893200200000001e-03 + T * (-1.8229792500000000e-07 + T * (1.4227930250000000e-11 + -4.9751097749999999e-16 * T))) - -1.6659934399999998e+04 / T);
+  }
+
+  k[418] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.5081952650000003e+00 + 2.7510040299999998e+00 * logT + T * (3.8249262396473334e-03 + T * (-1.4556374313340135e-06 + T * (5.1760130564159879e-10 + -8.2239404953613387e-14 * T))) - -7.1459463399999986e+03 / T);
+  } else {
+    Kc = (2.1037122539999999e+00 + 3.3951268600000000e+00 * logT + T * (1.8474262695421487e-03 + T * (-1.5611888135936581e-07 + T * (6.5209515945960296e-12 + 9.7074005090132177e-17 * T))) - -7.2077108999999991e+03 / T);
+  }
+
+  if (T <= 1382.0) {
+    Kc += (-8.0860173100000008e+00 + -1.6472798900000001e+00 * logT + T * (-6.3752671000000000e-03 + T * (1.7465705999999998e-06 + T * (-3.6786069666666668e-10 + 3.7876073300000002e-14 * T))) - -1.9299025200000000e+04 / T);
+  } else {
+    Kc += (1.6929264459999999e+01 + -5.5986045600000001e+00 * logT + T * (-1.5138931300000000e-03 + T * (1.7950724333333333e-07 + T * (-1.4305544000000000e-11 + 5.0719695499999999e-16 * T))) - -1.7966133900000001e+04 / T);
+  }
+
+  k[419] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4702867170000000e+00 + 4.2835363700000002e+00 * logT + T * (-1.3582460903526666e-03 + T * (1.3539415219993202e-06 + T * (-3.9204281819173466e-10 + 3.6982360096386612e-14 * T))) - -1.7931835899999998e+04 / T);
+  } else {
+    Kc = (1.1735859233999999e+01 + 2.0499277000000000e+00 * logT + T * (2.6349178265421486e-03 + T * (-3.2212230452603252e-07 + T * (3.0590211894596026e-11 + -1.4142693249098678e-15 * T))) - -1.7453575300000000e+04 / T);
+  }
+
+  if (T <= 1382.0) {
+    Kc += (-8.0860173100000008e+00 + -1.6472798900000001e+00 * logT + T * (-6.3752671000000000e-03 + T * (1.7465705999999998e-06 + T * (-3.6786069666666668e-10 + 3.7876073300000002e-14 * T))) - -1.9299025200000000e+04 / T);
+  } else {
+    Kc += (1.6929264459999999e+01 + -5.5986045600000001e+00 * logT + T * (-1.5138931300000000e-03 + T * (1.7950724333333333e-07 + T * (-1.4305544000000000e-11 + 5.0719695499999999e-16 * T))) - -1.7966133900000001e+04 / T);
+  }
+
+  k[420] = exp(Kc);
+
+  if (T <= 1368.0) {
+    Kc = (-1.8468721000000001e+00 + -2.7860495200000002e+00 * logT + T * (-3.4433396099999999e-03 + T * (5.3581310666666662e-07 + T * (-4.3099647250000000e-11 + -5.9680394000000003e-16 * T))) - 2.8269839999999999e+03 / T);
+  } else {
+    Kc = (1.2079527100000000e+01 + -4.8978488499999999e+00 * logT + T * (-1.5839469650000000e-03 + T * (1.8633510666666667e-07 + T * (-1.4770262000000000e-11 + 5.2169588499999993e-16 * T))) - 3.7065333099999998e+03 / T);
+  }
+
+  if (T <= 1478.0) {
+    Kc += (2.5636141000000001e+00 + 2.6309631699999998e+00 * logT + T * (3.6514117850000001e-03 + T * (-3.8008333833333334e-07 + T * (-5.5105941500000004e-11 + 1.8111787599999998e-14 * T))) - -1.5587363600000001e+04 / T);
+  } else {
+    Kc += (-1.4606198750000001e+01 + 5.2239513400000002e+00 * logT + T * (1.5893200200000001e-03 + T * (-1.8229792500000000e-07 + T * (1.4227930250000000e-11 + -4.9751097749999999e-16 * T))) - -1.6659934399999998e+04 / T);
+  }
+
+  k[421] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.3721898900000014e+00 + -1.8906642300000001e+00 * logT + T * (-6.8131993400000002e-03 + T * (2.2841488883333331e-06 + T * (-5.8605147633333348e-10 + 6.7923980050000029e-14 * T))) - -4.4248157999999996e+04 / T);
+  } else {
+    Kc = (1.1553270309999998e+01 + -5.1736257900000000e+00 * logT + T * (-1.6069584849999999e-03 + T * (1.7063323483333329e-07 + T * (-1.0472098416666672e-11 + 1.5383351499999994e-16 * T))) - -4.3400061999999998e+04 / T);
+  }
+
+  if (T <= 1382.0) {
+    Kc += (8.0860173100000008e+00 + 1.6472798900000001e+00 * logT + T * (6.3752671000000000e-03 + T * (-1.7465705999999998e-06 + T * (3.6786069666666668e-10 + -3.7876073300000002e-14 * T))) - 1.9299025200000000e+04 / T);
+  } else {
+    Kc += (-1.6929264459999999e+01 + 5.5986045600000001e+00 * logT + T * (1.5138931300000000e-03 + T * (-1.7950724333333333e-07 + T * (1.4305544000000000e-11 + -5.0719695499999999e-16 * T))) - 1.7966133900000001e+04 / T);
+  }
+
+  k[422] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.5695246169999995e+00 + -8.2192940000000014e-01 * logT + T * (1.8421406753526663e-03 + T * (-7.7651309366598670e-07 + T * (4.3738018769173463e-10 + -1.3894840754638661e-13 * T))) - -1.8438155900000005e+04 / T);
+  } else {
+    Kc = (-2.1028884694000002e+01 + 3.0080423900000000e+00 * logT + T * (-2.2227499715421484e-03 + T * (4.7010137935936583e-07 + T * (-6.5788824477929364e-11 + 3.9592063549098677e-15 * T))) - -1.9758588400000001e+04 / T);
+  }
+
+  k[423] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.3712497880000001e+00 + -1.5702706800000001e+00 * logT + T * (8.0103694999999996e-03 + T * (-6.4266887599999997e-06 + T * (3.0933943875000002e-09 + -6.4644388750000004e-13 * T))) - -5.8754937973000007e+04 / T);
+  } else {
+    Kc = (-1.7197102380000000e+01 + 2.4378577799999999e+00 * logT + T * (-2.1588853465499998e-03 + T * (4.2373424133333333e-07 + T * (-5.3273309416666666e-11 + 2.9488659100000001e-15 * T))) - -5.9452224222000004e+04 / T);
+  }
+
+  k[424] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.8509167610000001e+00 + -2.3769338000000007e-01 * logT + T * (5.2674526246473327e-03 + T * (-5.6816381996673469e-06 + T * (3.1128813914749324e-09 + -6.9979252545361348e-13 * T))) - 2.2360434270000023e+03 / T);
+  } else {
+    Kc = (-3.8417860860000004e+00 + 1.0375691900000001e+00 * logT + T * (-1.2541751250078512e-03 + T * (2.1556938697396752e-07 + T * (-2.3434039105403970e-11 + 1.2341854350901320e-15 * T))) - 2.2928339780000010e+03 / T);
+  }
+
+  k[425] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-3.8617708999999945e-01 + 1.2460063000000021e-01 * logT + T * (1.4596339599999995e-03 + T * (-2.1182024166666672e-06 + T * (1.2992108341666668e-09 + -3.1059347150000004e-13 * T))) - -5.2811687599999968e+03 / T);
+  } else {
+    Kc = (3.0280267999999921e-01 + 1.4139482000000037e-01 * logT + T * (-4.1522973799999990e-04 + T * (8.3896968999999994e-08 + T * (-9.2281592833333322e-12 + 4.8685165999999991e-16 * T))) - -5.1463012999999992e+03 / T);
+  }
+
+  k[426] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.4140524580000000e+00 + 7.4172382999999975e-01 * logT + T * (1.7161929099999997e-03 + T * (-2.7728006250000000e-06 + T * (1.6203583508333335e-09 + -3.6841389550000001e-13 * T))) - 3.1204598600000004e+03 / T);
+  } else {
+    Kc = (-1.0772759300000003e+00 + 7.2375689000000021e-01 * logT + T * (-9.1227198514999997e-04 + T * (1.4641938818333331e-07 + T * (-1.4964204641666667e-11 + 7.5855361449999985e-16 * T))) - 3.3577307000000010e+03 / T);
+  }
+
+  k[427] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-8.7544720899999984e+00 + 2.2633430500000000e+00 * logT + T * (-7.7881797650000001e-03 + T * (4.6837720699999996e-06 + T * (-1.7642435446666668e-09 + 2.9102145245000001e-13 * T))) - 3.6955517000000036e+03 / T);
+  } else {
+    Kc = (9.3593591400000022e+00 + -9.4671658000000036e-01 * logT + T * (-9.3639964999999684e-05 + T * (1.4254515983333333e-07 + T * (-2.6192173916666672e-11 + 1.6077366320000000e-15 * T))) - 4.2370276000000013e+03 / T);
+  }
+
+  k[428] = exp(Kc);
+
+  k[429] = exp(2.1854667948437513e+01 + 0.15 * logT);
+  k[430] = exp(2.3025850929940457e+01 - (3.7238247799578043e+04 / T));
+  k[431] = exp(1.8420680743952367e+01 - (3.2709271715845578e+04 / T));
+  k[432] = exp(3.3367593413407739e+01 - 1.38 * logT - (6.3908884737113669e+02 / T));
+  k[433] = exp(2.6393146759926932e+01 - 0.69 * logT - (3.8244686929296370e+02 / T));
+  k[434] = exp(2.4360851996672796e+01 - 0.36 * logT - (2.9186734761831440e+02 / T));
+  k[435] = exp(2.5287614028414247e+01 - (1.4492723467943888e+04 / T));
+  k[436] = exp(2.0723265836946410e+01 - (1.0945025535686789e+04 / T));
+  k[437] = exp(1.1492722757652709e+01 + 1.41 * logT - (4.2773663013028836e+03 / T));
+  k[438] = exp(1.1918390573078392e+01 + 1.57 * logT - (2.2141660853803161e+04 / T));
+  k[439] = exp(7.6962126393464070e+00 + 2.11 * logT - (5.7367030393944551e+03 / T));
+  k[440] = exp(1.0021270588192511e+01 + 1.7 * logT - (1.9122343464648184e+03 / T));
+  k[441] = exp(4.6539603501575231e+00 + 2.5 * logT - (6.6928202126268643e+03 / T));
+  k[442] = exp(1.0404262840448617e+01 + 1.5 * logT - (1.8115904334929860e+03 / T));
+  k[443] = exp(8.1016777474545716e+00 + 1.5 * logT - (1.8115904334929860e+03 / T));
+  k[444] = exp(3.0099120647400166e+01 - (4.2632761534868267e+04 / T));
+  k[445] = exp(2.8372958460657927e+01 - 0.69 * logT - (1.4341757598486138e+03 / T));
+  k[446] = exp(1.9413932516962650e+01 + 0.18 * logT - (1.0668254775014250e+03 / T));
+  k[447] = exp(2.5859064273996673e+01 - 0.75 * logT - (1.4543045424429804e+03 / T));
+  k[448] = exp(9.9034875525361272e+00 + 2.0 * logT - (1.0064391297183255e+03 / T));
+  k[449] = exp(2.7136724794113768e+01 - 0.31 * logT - (1.4593367380915720e+02 / T));
+  k[450] = exp(2.2031598656596589e+01 + 0.15 * logT - (-4.5289760837324650e+01 / T));
+  k[451] = exp(6.2915691395583204e+00 + 2.4 * logT - (4.9894219855785987e+03 / T));
+  k[452] = exp(1.0819778284410283e+01 + 1.6 * logT - (4.8057468444050045e+02 / T));
+  k[453] = exp(9.1484649682580947e+00 + 1.94 * logT - (3.2507983889901911e+03 / T));
+  k[454] = exp(2.3025850929940457e+01 - (7.2212007557289853e+03 / T));
+  if (T <= 1000.0) {
+    Kc = (2.0503790000000004e+00 + -5.1155920000000021e-01 * logT + T * (3.3535675350000000e-03 + T * (-2.6912835166666669e-06 + T * (1.3546791858333331e-09 + -2.9492676699999994e-13 * T))) - -3.0077857899999995e+04 / T);
+  } else {
+    Kc = (1.3736381500000001e+00 + -2.1794460000000004e-01 * logT + T * (6.4021701250000006e-04 + T * (-1.2974879833333334e-07 + T * (1.0710446250000000e-11 + -3.5169659000000000e-16 * T))) - -2.9927588700000004e+04 / T);
+  }
+
+  k[455] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (6.9536261999999995e+00 + -2.1570382800000001e+00 * logT + T * (6.5347924849999996e-03 + T * (-4.8443467149999997e-06 + T * (2.3179083683333331e-09 + -4.7890573240000005e-13 * T))) - -5.7209290200000003e+04 / T);
+  } else {
+    Kc = (4.0880058199999993e+00 + -1.3564055099999996e+00 * logT + T * (1.2819118299999999e-03 + T * (-2.4415369833333335e-07 + T * (3.1510935666666673e-11 + -1.8687476049999999e-15 * T))) - -5.7006382499999992e+04 / T);
+  }
+
+  k[456] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.1246941489999999e+01 + 2.9412362500000002e+00 * logT + T * (-7.1169632250000000e-03 + T * (3.1968998366666663e-06 + T * (-9.0735997799999998e-10 + 1.0214260245000000e-13 * T))) - -1.2232130300000004e+04 / T);
+  } else {
+    Kc = (7.5643547400000024e+00 + -2.9761198000000055e-01 * logT + T * (-6.6781458999999968e-04 + T * (1.5097357983333332e-07 + T * (-2.1183813000000005e-11 + 1.2423066550000001e-15 * T))) - -1.1605504800000002e+04 / T);
+  }
+
+  k[457] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (4.1807493069999992e+00 + -1.2184065799999999e+00 * logT + T * (1.0794207655352666e-02 + T * (-1.0308433526999320e-05 + T * (5.6773632118584010e-09 + -1.3116856005463866e-12 * T))) - -7.2168986300000015e+03 / T);
+  } else {
+    Kc = (-2.4451779924000004e+01 + 3.8701380699999999e+00 * logT + T * (-3.2144250046921485e-03 + T * (6.5420111787603255e-07 + T * (-8.7931754569596019e-11 + 5.1358777294098687e-15 * T))) - -8.1934835399999993e+03 / T);
+  }
+
+  k[458] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.8575363730000003e+00 + -2.4527328000000015e-01 * logT + T * (2.1363109803526664e-03 + T * (-1.4704039436659862e-06 + T * (7.1517632019173442e-10 + -1.6162240554638668e-13 * T))) - -3.8063103799999997e+04 / T);
+  } else {
+    Kc = (-2.5554281163999999e+01 + 3.3800336099999995e+00 * logT + T * (-2.7941195546921497e-03 + T * (6.1896742287603261e-07 + T * (-8.8202883736262678e-11 + 5.3714188294098668e-15 * T))) - -3.9194561199999996e+04 / T);
+  }
+
+  k[459] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (9.9810038200000006e-01 + -1.1605573699999998e+00 * logT + T * (-3.1467022704999995e-03 + T * (4.4828933683333333e-06 + T * (-2.5158797433333334e-09 + 5.6630328100000000e-13 * T))) - -5.3434359426999989e+04 / T);
+  } else {
+    Kc = (1.0130141320000000e+01 + -2.9300262100000003e+00 * logT + T * (3.1591945810499999e-03 + T * (-6.0517431883333331e-07 + T * (7.5494907249999997e-11 + -4.2174457649999999e-15 * T))) - -5.3286693178000001e+04 / T);
+  }
+
+  k[460] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.9823164400000004e+00 + 4.1685521999999953e-01 * logT + T * (-5.5798952564999997e-03 + T * (5.2204773899999998e-06 + T * (-2.5436988100000001e-09 + 5.1793896750000006e-13 * T))) - -3.0126794040000001e+04 / T);
+  } else {
+    Kc = (8.6427652200000011e+00 + -1.8265281099999995e+00 * logT + T * (1.9872731231500005e-03 + T * (-3.6895450534999996e-07 + T * (4.3895353008333338e-11 + -2.3356345495000007e-15 * T))) - -2.9953399480000000e+04 / T);
+  }
+
+  k[461] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.4039881000000154e-01 + -4.1759370999999978e-01 * logT + T * (4.4705988500000002e-03 + T * (-4.5389478750000000e-06 + T * (2.6800358791666669e-09 + -6.4893854799999999e-13 * T))) - -3.1521674399999974e+03 / T);
+  } else {
+    Kc = (-1.5747296370000001e+01 + 2.2458289400000009e+00 * logT + T * (-1.8843499268500008e-03 + T * (4.5618576964999986e-07 + T * (-6.9174234574999992e-11 + 4.3700325204999998e-15 * T))) - -3.8165152799999996e+03 / T);
+  }
+
+  k[462] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (7.3725952759999993e+00 + -1.8844437059999999e+00 * logT + T * (1.0047192465000000e-02 + T * (-8.3545226016666653e-06 + T * (4.0988278408333331e-09 + -8.5836470849999991e-13 * T))) - -7.0721144999999997e+03 / T);
+  } else {
+    Kc = (-1.2551252830000001e+01 + 1.8655187000000009e+00 * logT + T * (-1.8059149850000004e-03 + T * (4.0536391483333323e-07 + T * (-5.3787074499999997e-11 + 3.0509054349999997e-15 * T))) - -7.4765602670000007e+03 / T);
+  }
+
+  k[463] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.7960643519999988e+00 + -4.9664917000000042e-01 * logT + T * (7.4049305600000000e-03 + T * (-7.9447590916666680e-06 + T * (4.3789134091666670e-09 + -9.9061360050000000e-13 * T))) - -2.4128240400000000e+03 / T);
+  } else {
+    Kc = (-2.9671279300000020e+00 + 1.0950260900000006e+00 * logT + T * (-1.4790320851499998e-03 + T * (2.6120774484999991e-07 + T * (-2.9551873808333334e-11 + 1.4868796845000001e-15 * T))) - -2.2754782999999993e+03 / T);
+  }
+
+  k[464] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.0610335709999994e+00 + -1.4760663799999998e+00 * logT + T * (1.0956190274647334e-02 + T * (-1.0853596666334014e-05 + T * (5.8714364498082656e-09 + -1.3219922304536135e-12 * T))) - -3.2972404730000017e+03 / T);
+  } else {
+    Kc = (-5.7316380860000020e+00 + 1.4088383899999997e+00 * logT + T * (-1.8209352250078510e-03 + T * (3.3035774364063407e-07 + T * (-3.8021708272070643e-11 + 1.9625115050901322e-15 * T))) - -3.3403750219999965e+03 / T);
+  }
+
+  k[465] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-9.8390084700000102e-01 + -2.2677429999999976e-01 * logT + T * (-3.6901490503526658e-03 + T * (3.2143732336659863e-06 + T * (-1.3752132235250679e-09 + 2.4409805754638663e-13 * T))) - -1.6909265259999996e+04 / T);
+  } else {
+    Kc = (-4.1951879610000002e+00 + -3.5627329999999624e-02 * logT + T * (-4.3650321345785163e-04 + T * (2.3762872230730076e-07 + T * (-4.3026289772070637e-11 + 2.8861824800901319e-15 * T))) - -1.7432284989999996e+04 / T);
+  }
+
+  k[466] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-6.0983846269999997e+00 + 1.9857142400000005e+00 * logT + T * (-5.9857737853526664e-03 + T * (2.9364451936659867e-06 + T * (-1.0855833793584013e-09 + 2.0070804954638662e-13 * T))) - -6.7105727399999960e+03 / T);
+  } else {
+    Kc = (2.7188128534000001e+01 + -3.4177779099999999e+00 * logT + T * (2.0331323265421488e-03 + T * (-4.5466260435936579e-07 + T * (6.4818002227929371e-11 + -3.9153070499098678e-15 * T))) - -5.1764792500000003e+03 / T);
+  }
+
+  k[467] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (5.2159456710000018e+00 + -1.4288945800000001e+00 * logT + T * (7.6804094246473321e-03 + T * (-6.4607317330006798e-06 + T * (3.0549806731415985e-09 + -6.1290393795361344e-13 * T))) - -3.4955989712999995e+04 / T);
+  } else {
+    Kc = (3.5462512990000019e+00 + -6.2709349000000092e-01 * logT + T * (4.1180199999214882e-04 + T * (-1.5438593135936575e-07 + T * (2.8062424394596024e-11 + -1.8849056499098680e-15 * T))) - -3.4465193732000000e+04 / T);
+  }
+
+  k[468] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.9788518200000009e+00 + -1.0666005699999994e+00 * logT + T * (3.8725907599999991e-03 + T * (-2.8972959499999993e-06 + T * (1.2413101158333333e-09 + -2.2370488400000000e-13 * T))) - -4.2473201900000000e+04 / T);
+  } else {
+    Kc = (7.6908400650000006e+00 + -1.5232678600000003e+00 * logT + T * (1.2507473870000002e-03 + T * (-2.8605834933333325e-07 + T * (4.2268304216666665e-11 + -2.6322394249999997e-15 * T))) - -4.1904329010000001e+04 / T);
+  }
+
+  k[469] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.2709672719999983e+00 + 6.8399759000000060e-01 * logT + T * (-2.9922293800000001e-03 + T * (2.2005386833333331e-06 + T * (-1.0606578475000001e-09 + 2.2379308650000000e-13 * T))) - -4.4909058699999996e+03 / T);
+  } else {
+    Kc = (1.8781049570000000e+01 + -2.6037176000000000e+00 * logT + T * (2.4618512570000004e-03 + T * (-6.0305809300000002e-07 + T * (8.8109347466666671e-11 + -5.4093679400000002e-15 * T))) - -3.5795669200000002e+03 / T);
+  }
+
+  k[470] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.9936419700000002e+01 + -6.0465022699999995e+00 * logT + T * (1.4300108085000001e-02 + T * (-8.2230877600000006e-06 + T * (3.7338613208333330e-09 + -8.0399162200000022e-13 * T))) - -4.3245145300000004e+04 / T);
+  } else {
+    Kc = (-4.3128617749999997e+01 + 4.2937626599999996e+00 * logT + T * (-2.8824667850000010e-03 + T * (7.8289351000000012e-07 + T * (-1.1942542033333330e-10 + 7.4259473200000004e-15 * T))) - -4.6100620299999995e+04 / T);
+  }
+
+  k[471] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.1767372380000007e+00 + 9.4174631999999958e-01 * logT + T * (2.2270116000000051e-04 + T * (-9.5850737499999998e-07 + T * (3.8457190916666643e-10 + -4.4511165499999962e-14 * T))) - -9.1679563999999891e+02 / T);
+  } else {
+    Kc = (1.4124976699999987e+00 + 6.9202879000000017e-01 * logT + T * (-1.0968160851499995e-03 + T * (1.7884731151666654e-07 + T * (-1.9141580475000006e-11 + 9.4793428450000006e-16 * T))) - -5.9297249999999894e+02 / T);
+  }
+
+  k[472] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (3.0882319809999963e+00 + -3.7670890000000012e-02 * logT + T * (3.7739608746473353e-03 + T * (-3.8673449496673465e-06 + T * (1.8770949498082650e-09 + -3.7588979545361337e-13 * T))) - -1.8012120729999988e+03 / T);
+  } else {
+    Kc = (-1.3520124859999996e+00 + 1.0058410899999997e+00 * logT + T * (-1.4387192250078507e-03 + T * (2.4799731030730078e-07 + T * (-2.7611414938737315e-11 + 1.4235661050901322e-15 * T))) - -1.6578692219999975e+03 / T);
+  }
+
+  k[473] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (8.5113812999999983e-01 + 3.2462312000000004e-01 * logT + T * (-3.3857789999999430e-05 + T * (-3.0390916666666656e-07 + T * (6.3424392499999843e-11 + 1.3309258500000038e-14 * T))) - -9.3184242599999961e+03 / T);
+  } else {
+    Kc = (2.7925762799999982e+00 + 1.0966672000000033e-01 * logT + T * (-5.9977383799999953e-04 + T * (1.1632489233333324e-07 + T * (-1.3405535116666673e-11 + 6.7623233000000012e-16 * T))) - -9.0970044999999991e+03 / T);
+  }
+
+  k[474] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.5469436199999995e+00 + -9.2312670000000097e-02 * logT + T * (-1.8868495465000005e-03 + T * (1.3584396166666659e-06 + T * (-4.2226984166666672e-10 + 4.0469295500000020e-14 * T))) - -6.5929928600000021e+03 / T);
+  } else {
+    Kc = (-1.2268696199999991e+00 + -3.1635384999999960e-01 * logT + T * (7.9769594999999725e-05 + T * (4.6534500000000105e-08 + T * (-8.7640854999999874e-12 + 4.7770959999999990e-16 * T))) - -6.7923051869999981e+03 / T);
+  }
+
+  k[475] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-5.9192838099999996e+00 + 1.5942837200000000e+00 * logT + T * (-8.0572647749999997e-03 + T * (6.6206537733333336e-06 + T * (-3.2695998625000005e-09 + 6.9919299800000005e-13 * T))) - -2.1012633999999998e+03 / T);
+  } else {
+    Kc = (1.4411719535000000e+01 + -2.0423043249999999e+00 * logT + T * (1.6615051650000004e-03 + T * (-2.9286458500000005e-07 + T * (3.9622509666666650e-11 + -2.3327002800000002e-15 * T))) - -1.4779792899999993e+03 / T);
+  }
+
+  k[476] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (2.2001903790000000e+01 + -5.5812400800000006e+00 * logT + T * (1.5775775360000001e-02 + T * (-1.0074865626666667e-05 + T * (4.7017067124999990e-09 + -1.0079523820000001e-12 * T))) - -1.0902911730000002e+04 / T);
+  } else {
+    Kc = (-3.7646490910000004e+01 + 4.3808698200000000e+00 * logT + T * (-2.9205562349999999e-03 + T * (7.3576677166666677e-07 + T * (-1.0874399783333334e-10 + 6.6514608200000001e-15 * T))) - -1.3417036839999997e+04 / T);
+  }
+
+  k[477] = 8.2057360967184814e-02 * exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-2.2744840250000003e+01 + 4.8803699299999996e+00 * logT + T * (-1.8403791885000000e-02 + T * (1.3002193923333333e-05 + T * (-6.0086292883333325e-09 + 1.2371129445000000e-12 * T))) - -4.1221452400000002e+04 / T);
+  } else {
+    Kc = (4.4371371639999992e+01 + -6.5567729799999999e+00 * logT + T * (5.3195220668500005e-03 + T * (-1.1938802114833333e-06 + T * (1.6713507415833332e-10 + -9.9931596455000007e-15 * T))) - -3.8654324999999997e+04 / T);
+  }
+
+  k[478] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (1.1438128429999992e+00 + -1.6179979899999999e+00 * logT + T * (2.1629949964733358e-04 + T * (6.2098645033265328e-07 + T * (-1.9732750019173448e-10 + 7.0839150463866008e-15 * T))) - -5.0064042900000000e+04 / T);
+  } else {
+    Kc = (7.0307582400000257e-01 + -1.6685619100000002e+00 * logT + T * (1.4140180115421487e-03 + T * (-1.6475451935936566e-07 + T * (1.2647549561262703e-11 + -4.2228927490986804e-16 * T))) - -5.0239609500000006e+04 / T);
+  }
+
+  k[479] = 8.2057360967184814e-02 * exp(Kc);
+
+  k[480] = exp(2.9449097893473976e+01 - 0.752 * logT - (1.7361074987641115e+02 / T));
+  k[481] = exp(2.1901920833288056e+01 - (-3.5476979322570975e+02 / T));
+  k[482] = exp(2.1821878125614521e+01 - (5.6863810829085387e+03 / T));
+  k[483] = exp(8.8098628053790566e+00 + 1.83 * logT - (1.1070830426901580e+02 / T));
+  k[484] = exp(2.9240459028362647e+01 - (8.7207950590092896e+03 / T));
+  k[485] = exp(1.5894952099644110e+01 + 0.5 * logT - (-8.8315033632783059e+02 / T));
+  k[486] = exp(2.1401299379696308e+01 + 0.43 * logT - (-1.8619123899789022e+02 / T));
+  k[487] = exp(2.2481123754498785e+01 - (7.5482934728874409e+02 / T));
+  k[488] = exp(2.1598734574300313e+01 - (7.5482934728874409e+02 / T));
+  k[489] = exp(2.6021583203494448e+01 - (5.5298797982373399e+03 / T));
+  k[490] = exp(1.8037955122813692e+01 + 0.25 * logT - (-4.7051029314331714e+02 / T));
+  k[491] = exp(1.9529243363473643e+01 + 0.29 * logT - (5.5354152134507899e+00 / T));
+  k[492] = exp(7.1981835771019433e+00 + 1.61 * logT - (-1.9323631290591851e+02 / T));
+  k[493] = exp(2.1794849453226600e+01 - (9.0982097326536621e+02 / T));
+  k[494] = exp(2.4127791008701241e+01 - (1.9701045964236222e+04 / T));
+  k[495] = exp(1.4533350351114590e+01 + 1.16 * logT - (1.2102430534862865e+03 / T));
+  k[496] = exp(1.6969527810483978e+01 + 0.73 * logT - (-5.6008337568824811e+02 / T));
+  k[497] = exp(2.1825205915707194e+01 - (5.9998868718157973e+03 / T));
+  k[498] = exp(7.9083871592900428e+00 + 1.77 * logT - (2.9790598239662436e+03 / T));
+  k[499] = exp(2.0002747459590335e+01 + 0.422 * logT - (-8.8315033632783059e+02 / T));
+  k[500] = exp(5.2626901889048856e+00 + 2.68 * logT - (1.8699639030166488e+03 / T));
+  k[501] = exp(7.1853870155804165e+00 + 2.54 * logT - (3.3997513801885034e+03 / T));
+  k[502] = exp(1.0360912399575003e+01 + 1.8 * logT - (4.7000707357845801e+02 / T));
+  k[503] = exp(-9.7286108336254939e-01 + 2.72 * logT - (7.5482934728874409e+02 / T));
+  k[504] = exp(-7.0097880045472882e+00 + 3.65 * logT - (3.6000327670024503e+03 / T));
+  k[505] = exp(7.8438486381524717e+00 + 1.6 * logT - (2.8683515196972276e+03 / T));
+  if (T <= 1000.0) {
+    Kc = (-1.8792606857000003e+01 + 4.4285042800000003e+00 * logT + T * (-1.4083808585352667e-02 + T * (8.8440742103326544e-06 + T * (-3.9311888210250679e-09 + 8.1107553704638672e-13 * T))) - -6.8188975999999948e+03 / T);
+  } else {
+    Kc = (4.3831693573999999e+01 + -5.9623245699999998e+00 * logT + T * (4.2964847965421497e-03 + T * (-9.4764802935936579e-07 + T * (1.3207296989459603e-10 + -7.8482365949098669e-15 * T))) - -4.1389892000000036e+03 / T);
+  }
+
+  k[506] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.3965189502000001e+01 + 3.1267876299999995e+00 * logT + T * (-1.1090264180000000e-02 + T * (8.1081677000000007e-06 + T * (-3.9062632891666661e-09 + 8.3416057400000011e-13 * T))) - -4.5992307299999993e+03 / T);
+  } else {
+    Kc = (3.5424614609999992e+01 + -5.1482642599999995e+00 * logT + T * (4.7252037270000009e-03 + T * (-1.0960435179999999e-06 + T * (1.5536431513333333e-10 + -9.3422974850000000e-15 * T))) - -2.5420768699999999e+03 / T);
+  }
+
+  k[507] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.3425150799999996e+00 + -6.3733963999999954e-01 * logT + T * (1.0924926749999993e-03 + T * (-1.2641780649999996e-06 + T * (1.0189303591666671e-09 + -2.9534222850000009e-13 * T))) - -2.5949134600000001e+04 / T);
+  } else {
+    Kc = (1.5919510000000159e-01 + -9.0323496000000070e-01 * logT + T * (1.0356517049999994e-03 + T * (-1.8547260316666660e-07 + T * (2.0582897916666666e-11 + -9.6633554500000005e-16 * T))) - -2.5966264032999999e+04 / T);
+  }
+
+  k[508] = exp(Kc);
+
+  if (T <= 1000.0) {
+    Kc = (-1.7200494010000000e+01 + 3.8877891599999987e+00 * logT + T * (-1.8188054794999998e-02 + T * (1.5219714806666666e-05 + T * (-7.7787148291666661e-09 + 1.7092348230000002e-12 * T))) - -1.3936088000000000e+03 / T);
+  } else {
+    Kc = (4.0004080389999999e+01 + -6.0791035800000000e+00 * logT + T * (5.7552205150000011e-03 + T * (-1.2822779800000002e-06 + T * (1.7880693633333333e-10 + -1.0658771429999999e-14 * T))) - 6.4102210000000196e+02 / T);
+  }
+
+  k[509] = exp(Kc);
+
+  k[510] = exp(8.3089382525957785e+00 + 2.19 * logT - (4.4786541272465485e+02 / T));
+  k[511] = exp(1.7054189010128656e+01 + 0.255 * logT - (-4.7453604966219046e+02 / T));
+  k[512] = exp(2.3681815319372685e+01 - 0.32 * logT);
+
+} // end eval_rate_constants
+
@@ -0,0 +1,7 @@
+#ifndef RATE_TABLE_SIZE_HEAD
+#define RATE_TABLE_SIZE_HEAD
+
+/** Number of tabulated rate constants, generated by tabulateRates.py */
+#define N_RATE_CONST 513
+
+#endif
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Tabulate the temperature-only rate expressions of the pyJac Jacobian.
+
+Rewrites the generated jacobs/jacob_*.c so that, compiled with
+-DPYJAC_RATE_TABLE, the forward rate constants (kf = exp(...)) and the
+equilibrium constants (Kc) are read from the table of rate_table.c instead
+of being evaluated on every call.  The original expressions are kept in the
+#else branches.  Writes rate_table_exprs.c, which evaluates the expressions
+exactly to build the table, and rate_table_size.h.
+
+Run in pyjacInclude after the pyJac sources have been regenerated:
+
+    python3 tabulateRates.py
+"""
+
+import glob
+import os
+import re
+import sys
+
+MARKER = 'PYJAC_RATE_TABLE'
+
+# Equilibrium constant: the polynomial of the first product, those of
+# further species added, then the exponential
+KC_BLOCK = re.compile(
+    r'^  if \(T <= [0-9.]+\) \{\n    Kc = \([^;]*\);\n'
+    r'  \} else \{\n    Kc = \([^;]*\);\n  \}\n\n'
+    r'(?:  if \(T <= [0-9.]+\) \{\n    Kc \+= \([^;]*\);\n'
+    r'  \} else \{\n    Kc \+= \([^;]*\);\n  \}\n\n)*'
+    r'  Kc = ((?:[-0-9.e+]+ \* )?exp\(Kc\));\n',
+    re.M
+)
+
+# Arrhenius forward rate constant
+KF_LINE = re.compile(r'^  kf = (exp\([-0-9.e+ */()logT]*\));\n', re.M)
+
+LOG_T = '  double logT = log(T);\n'
+
+# The #else branches of the tabulated expressions
+ELSE_BRANCH = re.compile(
+    r'^#else\n.*?^#endif\n', re.M | re.S
+)
+
+
+def rateTable(src):
+    """Declare the table row, and logT only if used besides the table"""
+    rest = ELSE_BRANCH.sub('', src.replace(LOG_T, '', 1))
+    rt = '  const double * __restrict__ rt = rate_table_eval(T);\n'
+
+    if re.search(r'\blogT\b', rest):
+        return src.replace(
+            LOG_T, LOG_T + '#ifdef {0}\n{1}#endif\n'.format(MARKER, rt)
+        )
+
+    return src.replace(
+        LOG_T, '#ifdef {0}\n{1}#else\n{2}#endif\n'.format(MARKER, rt, LOG_T)
+    )
+
+
+def main():
+    jacobs = sorted(
+        glob.glob(os.path.join('jacobs', 'jacob_*.c')),
+        key=lambda f: int(re.search(r'(\d+)\.c$', f).group(1))
+    )
+
+    index = {}
+    exprs = []
+
+    def entry(key, expr):
+        if key not in index:
+            index[key] = len(exprs)
+            exprs.append(expr)
+        return index[key]
+
+    def kc(match):
+        block = match.group(0)
+        polys = block[:block.rindex('  Kc = ')]
+        i = entry(block, polys + '  k[@] = ' + match.group(1) + ';\n\n')
+        return ('#ifdef {0}\n  Kc = rt[{1}];\n#else\n{2}#endif\n'
+                .format(MARKER, i, block))
+
+    def kf(match):
+        line = match.group(0)
+        i = entry(line, '  k[@] = ' + match.group(1) + ';\n')
+        return ('#ifdef {0}\n  kf = rt[{1}];\n#else\n{2}#endif\n'
+                .format(MARKER, i, line))
+
+    for name in jacobs:
+        with open(name) as f:
+            src = f.read()
+
+        if MARKER in src:
+            sys.exit(name + ' has already been rewritten')
+
+        out, nkc = KC_BLOCK.subn(kc, src)
+        out, nkf = KF_LINE.subn(kf, out)
+
+        if nkc + nkf:
+            if out.count(LOG_T) != 1:
+                sys.exit(name + ': expected one evaluation of logT')
+
+            out = rateTable(out)
+            out = out.replace(
+                '#include "header.h"\n',
+                '#include "header.h"\n#include "rate_table.h"\n', 1
+            )
+
+            with open(name, 'w') as f:
+                f.write(out)
+
+        print('{0}: {1} Kc, {2} kf'.format(name, nkc, nkf))
+
+    with open('rate_table_size.h', 'w') as f:
+        f.write(
+            '#ifndef RATE_TABLE_SIZE_HEAD\n#define RATE_TABLE_SIZE_HEAD\n\n'
+            '/** Number of tabulated rate constants, generated by '
+            'tabulateRates.py */\n'
+            '#define N_RATE_CONST {0}\n\n#endif\n'.format(len(exprs))
+        )
+
+    with open('rate_table_exprs.c', 'w') as f:
+        f.write(
+            '#include <math.h>\n#include "header.h"\n'
+            '#include "rate_table.h"\n\n'
+            '/** Generated by tabulateRates.py from the jacobs/jacob_*.c */\n'
+            'void eval_rate_constants (const double T, '
+            'double * __restrict__ k) {\n'
+            '  double logT = log(T);\n  double Kc = 0.0;\n\n'
+        )
+
+        for i, expr in enumerate(exprs):
+            f.write(expr.replace('k[@]', 'k[{0}]'.format(i)))
+
+        f.write('\n} // end eval_rate_constants\n\n')
+
+    print('{0} rate constants tabulated'.format(len(exprs)))
+
+
+if __name__ == '__main__':
+    main()
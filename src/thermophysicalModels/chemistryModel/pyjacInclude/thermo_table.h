@@ -0,0 +1,23 @@
+#ifndef THERMO_TABLE_HEAD
+#define THERMO_TABLE_HEAD
+
+#include "header.h"
+
+/** Opaque species thermo table, a Foam::speciesThermoTable */
+typedef struct thermo_table thermo_table;
+
+/**
+ * Species enthalpy and heat capacity as eval_h and eval_cp, interpolated
+ * from the species thermo table within its range, otherwise evaluated
+ * exactly.  The table is that of the pyjacHePsiThermo of the chemistry
+ * model (thermoTable in thermophysicalProperties), NULL for none.
+ *
+ * The dydt_jacob.c generated by fuseDydtJacob.py calls these instead of
+ * eval_h and eval_cp when compiled with -DPYJAC_THERMO_TABLE, so that the
+ * right-hand side and the Jacobian read the same table as the thermo.
+ * Defined in libpyjacChemistryModel.
+ */
+void thermo_table_h (const thermo_table *, const double, double * __restrict__);
+void thermo_table_cp (const thermo_table *, const double, double * __restrict__);
+
+#endif
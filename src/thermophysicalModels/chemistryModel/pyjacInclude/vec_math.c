@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "vec_math.h"
+
+#ifdef COMPILE_TESTING_METHODS
+
+/** Distance in units in the last place between a and b */
+static double ulp_error (const double a, const double b) {
+  if (a == b) {
+    return 0.0;
+  }
+  return fabs(a - b) / fabs(nextafter(b, INFINITY) - b);
+}
+
+/** Compare vm_exp, vm_log, vm_log10 and vm_pow with libm, 0 if all agree */
+int test_vec_math() {
+  enum { N = 1 << 20 };
+  double * x = (double *) malloc(N * sizeof(double));
+  double * y = (double *) malloc(N * sizeof(double));
+  double max_exp = 0.0, max_log = 0.0, max_log10 = 0.0, max_pow = 0.0;
+
+  // exp over the range of the kernels, through the batch variant
+  for (int k = 0; k < N; ++k) {
+    x[k] = -700.0 + 1400.0 * k / (N - 1);
+  }
+  vm_exp_n(N, x, y);
+  for (int k = 0; k < N; ++k) {
+    max_exp = fmax(max_exp, ulp_error(y[k], exp(x[k])));
+  }
+
+  // log over the normal range, log-uniformly
+  for (int k = 0; k < N; ++k) {
+    x[k] = exp(-700.0 + 1400.0 * k / (N - 1));
+  }
+  vm_log_n(N, x, y);
+  for (int k = 0; k < N; ++k) {
+    max_log = fmax(max_log, ulp_error(y[k], log(x[k])));
+    max_log10 = fmax(max_log10, ulp_error(vm_log10(x[k]), log10(x[k])));
+  }
+
+  // pow of the Troe falloff, Fcent in (0, 1] to powers of order 1
+  srand(1);
+  for (int k = 0; k < N; ++k) {
+    const double a = (double) rand() / RAND_MAX + 1.0e-3;
+    const double b = 4.0 * rand() / RAND_MAX - 2.0;
+    max_pow = fmax(max_pow, fabs(vm_pow(a, b) - pow(a, b)) / pow(a, b));
+  }
+
+  free(x);
+  free(y);
+
+  // log of subnormals
+  double max_sub = 0.0;
+  for (int k = 1; k <= 1074; ++k) {
+    const double xs = ldexp(1.0, -k) * 1.2345;
+    if (xs > 0.0) {
+      max_sub = fmax(max_sub, ulp_error(vm_log(xs), log(xs)));
+    }
+  }
+
+  // saturation outside the normal range
+  const int saturated =
+    vm_exp(-800.0) == 0.0 && vm_exp(800.0) == HUGE_VAL && vm_exp(0.0) == 1.0
+ && vm_exp(-INFINITY) == 0.0 && vm_exp(INFINITY) == HUGE_VAL;
+
+  // special arguments
+  const int special =
+    isnan(vm_exp(NAN)) && isnan(vm_log(NAN)) && isnan(vm_log(-1.0))
+ && isnan(vm_log(-INFINITY)) && vm_log(0.0) == -HUGE_VAL
+ && vm_log(-0.0) == -HUGE_VAL && vm_log(INFINITY) == HUGE_VAL
+ && vm_log(1.0) == 0.0;
+
+  printf("vm_exp   max error %g ulp\n", max_exp);
+  printf("vm_log   max error %g ulp\n", max_log);
+  printf("vm_log10 max error %g ulp\n", max_log10);
+  printf("vm_pow   max relative error %g\n", max_pow);
+  printf("vm_log   max error %g ulp for subnormals\n", max_sub);
+  printf("vm_exp   %s outside [-708, 709]\n", saturated ? "saturates" : "FAILS");
+  printf("vm_exp, vm_log of NaN, 0, negative, infinite %s\n",
+         special ? "pass" : "FAIL");
+
+  return !(saturated && special && max_exp <= 2.0 && max_log <= 2.0
+           && max_sub <= 2.0 && max_log10 <= 2.0 && max_pow <= 1.0e-14);
+}
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef VEC_MATH_HEAD
+#define VEC_MATH_HEAD
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+/**
+ * Vectorisable double precision exp, log, log10 and pow for the generated
+ * pyJac kernels.
+ *
+ * Branch-free range reduction and polynomial evaluation, declared
+ * "omp declare simd" so loops over cells calling them vectorise (AVX2,
+ * AVX-512) when compiled with -fopenmp or -fopenmp-simd.  exp and log are
+ * within 2 ulp of libm; pow is exp(y*log(x)) and loses accuracy in
+ * proportion to |y*log(x)|.  exp returns 0 below -708 (no subnormals),
+ * HUGE_VAL above 709 and NaN for NaN.  log is accurate also for subnormal
+ * arguments and returns -HUGE_VAL for 0, HUGE_VAL for HUGE_VAL, NaN for
+ * NaN and negative arguments.  The special cases are selected by bit masks
+ * rather than branches.
+ *
+ * Compiled with -DPYJAC_VEC_MATH, header.h includes this file and maps exp,
+ * log, log10 and pow of the kernels onto vm_exp, vm_log, vm_log10 and
+ * vm_pow; see Make/options.  The test_vec_math of vec_math.c is run by
+ * Test-vecMath (test/vecMath).
+ */
+
+#if defined(_OPENMP) || defined(PYJAC_SIMD)
+  #define VM_DECLARE_SIMD _Pragma("omp declare simd notinbranch")
+  #define VM_SIMD_LOOP _Pragma("omp simd")
+#else
+  #define VM_DECLARE_SIMD
+  #define VM_SIMD_LOOP
+#endif
+
+static inline double vm_from_bits (const uint64_t i) {
+  double x;
+  memcpy(&x, &i, sizeof(x));
+  return x;
+}
+
+static inline uint64_t vm_to_bits (const double x) {
+  uint64_t i;
+  memcpy(&i, &x, sizeof(i));
+  return i;
+}
+
+VM_DECLARE_SIMD
+static inline double vm_exp (double x) {
+  const double log2e = 1.4426950408889634074;
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+
+  // x = n ln2 + r, |r| <= ln2/2, n rounded by the 1.5 2^52 shift so that
+  // it is also held in the low bits of t
+  const double shift = 6755399441055744.0;
+  const double t = x * log2e + shift;
+  const double n = t - shift;
+  const double r = (x - n * ln2_hi) - n * ln2_lo;
+
+  // Taylor polynomial of exp(r) to degree 13
+  double p = 1.0 / 6227020800.0;
+  p = p * r + 1.0 / 479001600.0;
+  p = p * r + 1.0 / 39916800.0;
+  p = p * r + 1.0 / 3628800.0;
+  p = p * r + 1.0 / 362880.0;
+  p = p * r + 1.0 / 40320.0;
+  p = p * r + 1.0 / 5040.0;
+  p = p * r + 1.0 / 720.0;
+  p = p * r + 1.0 / 120.0;
+  p = p * r + 1.0 / 24.0;
+  p = p * r + 1.0 / 6.0;
+  p = p * r + 0.5;
+  p = p * r + 1.0;
+  p = p * r + 1.0;
+
+  // 2^n from the exponent bits, saturated by bit masks rather than branches
+  // so that calling loops if-convert without -fno-trapping-math
+  const int64_t ni = (int64_t)(vm_to_bits(t) - vm_to_bits(shift));
+  const uint64_t nan = -(uint64_t)(x != x);
+  const uint64_t under = -(uint64_t)(ni < -1022) & ~nan;
+  const uint64_t over = -(uint64_t)(ni > 1023) & ~nan;
+  const double y = p * vm_from_bits((uint64_t)(ni + 1023) << 52);
+
+  return vm_from_bits
+  (
+    (vm_to_bits(y) & ~(under | over | nan))
+  | (over & vm_to_bits(HUGE_VAL))
+  | (nan & vm_to_bits(x))
+  );
+}
+
+VM_DECLARE_SIMD
+static inline double vm_log (const double x) {
+  const double ln2_hi = 6.93147180369123816490e-01;
+  const double ln2_lo = 1.90821492927058770002e-10;
+
+  // Subnormal x scaled by 2^52 into the normal range
+  const uint64_t sub = -(uint64_t)(x < 2.2250738585072014e-308);
+  const double xs =
+    x * vm_from_bits(0x3ff0000000000000ULL + (sub & 0x0340000000000000ULL));
+
+  // x = m 2^e, m in [sqrt(2)/2, sqrt(2)), the biased exponent converted
+  // through the bits of 2^52 + e and the mantissa compared with sqrt(2)
+  // as an integer
+  const uint64_t bits = vm_to_bits(xs);
+  const double two52 = 4503599627370496.0;
+  double e = vm_from_bits((bits >> 52) | 0x4330000000000000ULL) - (two52 + 1023.0);
+  double m = vm_from_bits((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+
+  const uint64_t big =
+    -(uint64_t)((int64_t)(bits & 0x000fffffffffffffULL) > 0x6a09e667f3bcdLL);
+  m *= vm_from_bits(0x3ff0000000000000ULL - (big & 0x0010000000000000ULL));
+  e += vm_from_bits(big & 0x3ff0000000000000ULL);
+  e -= vm_from_bits(sub & 0x404a000000000000ULL);
+
+  // log(m) = 2 atanh(f), f = (m - 1)/(m + 1), |f| < 0.172
+  const double f = (m - 1.0) / (m + 1.0);
+  const double f2 = f * f;
+
+  double p = 1.0 / 21.0;
+  p = p * f2 + 1.0 / 19.0;
+  p = p * f2 + 1.0 / 17.0;
+  p = p * f2 + 1.0 / 15.0;
+  p = p * f2 + 1.0 / 13.0;
+  p = p * f2 + 1.0 / 11.0;
+  p = p * f2 + 1.0 / 9.0;
+  p = p * f2 + 1.0 / 7.0;
+  p = p * f2 + 1.0 / 5.0;
+  p = p * f2 + 1.0 / 3.0;
+
+  // 2 f (1 + f2 p) with the leading 2 f kept exact
+  const double y = e * ln2_hi + (2.0 * f + (2.0 * f * f2 * p + e * ln2_lo));
+
+  // NaN passed through, negative to NaN, 0 to -HUGE_VAL, HUGE_VAL to itself
+  const uint64_t nan = -(uint64_t)(x != x);
+  const uint64_t neg = -(uint64_t)(x < 0.0);
+  const uint64_t zero = -(uint64_t)(x == 0.0);
+  const uint64_t inf = -(uint64_t)(x == HUGE_VAL);
+
+  return vm_from_bits
+  (
+    (vm_to_bits(y) & ~(nan | neg | zero | inf))
+  | (nan & vm_to_bits(x))
+  | (neg & 0x7ff8000000000000ULL)
+  | (zero & vm_to_bits(-HUGE_VAL))
+  | (inf & vm_to_bits(HUGE_VAL))
+  );
+}
+
+VM_DECLARE_SIMD
+static inline double vm_log10 (const double x) {
+  return 0.43429448190325182765 * vm_log(x);
+}
+
+VM_DECLARE_SIMD
+static inline double vm_pow (const double x, const double y) {
+  return vm_exp(y * vm_log(x));
+}
+
+/** y[k] = exp(x[k]) for the n values of a batch */
+static inline void vm_exp_n (const int n, const double * __restrict__ x, double * __restrict__ y) {
+  VM_SIMD_LOOP
+  for (int k = 0; k < n; ++k) {
+    y[k] = vm_exp(x[k]);
+  }
+}
+
+/** y[k] = log(x[k]) for the n values of a batch */
+static inline void vm_log_n (const int n, const double * __restrict__ x, double * __restrict__ y) {
+  VM_SIMD_LOOP
+  for (int k = 0; k < n; ++k) {
+    y[k] = vm_log(x[k]);
+  }
+}
+
+#ifdef COMPILE_TESTING_METHODS
+  int test_vec_math();
+#endif
+
+#endif
@@ -0,0 +1,12 @@
+/**
+ * Runs test_vec_math, which compares the vectorised exp, log, log10 and pow
+ * of the pyJac kernels (pyjacInclude/vec_math.h) with libm, including their
+ * subnormal, zero, negative, infinite and NaN arguments.  Exits non-zero on
+ * failure.
+ */
+
+#include "vec_math.c"
+
+int main() {
+  return test_vec_math();
+}